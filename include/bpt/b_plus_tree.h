@@ -6,20 +6,64 @@
 #include <cmath>
 #include <fstream>
 #include <sstream>
-
-#include "common/storage_interface.h"
+#include <new>
+#include <numeric>
+#include <initializer_list>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include "common/ordered_storage_interface.h"
+#include "common/slab_arena.h"
 #include "common/timer.h"
+#include "inline_array.h"
+#include "node_search.h"
 
 namespace s21
 {
 
-template<class Key, class Tp = Value>
-class BPlusTree : public KeyValueStorageInterface<Key, Tp>
+// kEager rebalances a node as soon as it is less than half full. kLazy lets nodes
+// empty down to a quarter of that before borrowing or merging, so erasing and then
+// inserting the same keys again does not merge and split the same nodes over and
+// over; Compact packs the nodes again when the tree is left underfull.
+enum class ErasePolicy
+{
+    kEager,
+    kLazy,
+};
+
+/*
+Each node is a single cache line aligned allocation: the node header followed by
+its keys and then either its values (leaves) or its children and the number of
+entries under each child (internal nodes), with capacities fixed by the tree
+order. The counts let Rank, Select and CountRange add up whole subtrees on the
+way down instead of walking the leaves. Internal nodes carry no value storage,
+so a lookup touches one contiguous block per level. Keys inside a node are found
+with the Search policy (see node_search.h); hints of a policy that keeps them are
+stored between the header and the keys.
+
+Nodes come from two SlabArenas of the tree, one for leaves and one for internal
+nodes, so splits and merges reuse the blocks of freed nodes instead of going to
+the global allocator. The destructor gives the slabs back at once and walks the
+nodes only when keys or values need their destructors run.
+
+With CompressKeys, a leaf stores the prefix shared by all of its keys once and
+keeps only the rest of each key, which for keys with long common prefixes often
+fits the string's inline buffer. Separators pushed up from leaves are cut to the
+shortest string that still divides the two leaves.
+*/
+template<class Key, class Tp = Value, class Search = DefaultNodeSearch<Key>, bool CompressKeys = std::is_same_v<Key, std::string>>
+class BPlusTree : public OrderedKeyValueStorageInterface<Key, Tp>
 {
+    static_assert(!CompressKeys || std::is_same_v<Key, std::string>, "Only string keys can be compressed.");
+
 public:
-    using key_type = typename KeyValueStorageInterface<Key, Tp>::key_type;
-    using mapped_type = typename KeyValueStorageInterface<Key, Tp>::mapped_type;
-    using size_type = typename KeyValueStorageInterface<Key, Tp>::size_type;
+    using key_type = typename OrderedKeyValueStorageInterface<Key, Tp>::key_type;
+    using mapped_type = typename OrderedKeyValueStorageInterface<Key, Tp>::mapped_type;
+    using size_type = typename OrderedKeyValueStorageInterface<Key, Tp>::size_type;
+    using key_view_type = typename OrderedKeyValueStorageInterface<Key, Tp>::key_view_type;
+    using ScanCursor = typename OrderedKeyValueStorageInterface<Key, Tp>::ScanCursor;
+    using ScanResult = typename OrderedKeyValueStorageInterface<Key, Tp>::ScanResult;
 
 private:
     class BPlusTreeNode
@@ -28,24 +72,35 @@ private:
         using key_type = BPlusTree::key_type;
         using mapped_type = BPlusTree::mapped_type;
         using size_type = BPlusTree::size_type;
+        using key_view_type = BPlusTree::key_view_type;
+        using hint_type = typename Search::hint_type;
 
     public:
-        explicit BPlusTreeNode(bool leaf);
+        static BPlusTreeNode* Create(SlabArena& arena, bool leaf, size_type order);
+        static void Destroy(SlabArena& arena, BPlusTreeNode* node) noexcept;
+        [[nodiscard]] static size_type AllocationSize(bool leaf, size_type order) noexcept;
+
+        BPlusTreeNode(const BPlusTreeNode&) = delete;
+        BPlusTreeNode& operator=(const BPlusTreeNode&) = delete;
 
         [[nodiscard]] bool IsLeaf() const noexcept;
-        [[nodiscard]] std::vector<key_type>& Keys();
-        [[nodiscard]] std::vector<mapped_type>& Values();
-        [[nodiscard]] std::vector<BPlusTreeNode*>& Children();
+        // The keys as stored: without the common prefix in a compressed leaf.
+        [[nodiscard]] const InlineArray<key_type>& Keys() const noexcept;
+        [[nodiscard]] key_type KeyAt(size_type index) const;
+        [[nodiscard]] InlineArray<mapped_type>& Values();
+        [[nodiscard]] InlineArray<BPlusTreeNode*>& Children();
+        // The number of entries under each child, in the order of Children().
+        [[nodiscard]] const InlineArray<size_type>& ChildCounts() const noexcept;
         [[nodiscard]] size_type Size() const noexcept;
-        [[nodiscard]] size_type GetKeyIndex(const key_type& key) const noexcept;
-        [[nodiscard]] size_type GetChildIndex(const BPlusTreeNode* child) const noexcept;
-        [[nodiscard]] std::pair<size_type, size_type> GetKeyChildIndex(const key_type& key, const BPlusTreeNode* child) const noexcept;
-        [[nodiscard]] bool Exists(const key_type& key) const noexcept;
-        [[nodiscard]] bool Exists(const key_type& key, const size_type& index) const noexcept;
+        // The number of entries under the node.
+        [[nodiscard]] size_type Count() const noexcept;
+        [[nodiscard]] size_type GetKeyIndex(key_view_type key) const noexcept;
+        [[nodiscard]] bool Exists(key_view_type key) const noexcept;
+        [[nodiscard]] bool Exists(key_view_type key, const size_type& index) const noexcept;
         [[nodiscard]] BPlusTreeNode* GetParent() const noexcept;
         [[nodiscard]] BPlusTreeNode* GetLeft() const noexcept;
         [[nodiscard]] BPlusTreeNode* GetRight() const noexcept;
-        [[nodiscard]] mapped_type& GetValue(const key_type& key);
+        [[nodiscard]] mapped_type& GetValue(key_view_type key);
 
         void SetParent(BPlusTreeNode* node) noexcept;
         void SetLeft(BPlusTreeNode* node) noexcept;
@@ -53,67 +108,118 @@ private:
         void MoveCells(BPlusTreeNode* dest, const key_type& limit);
         void MoveAllCells(BPlusTreeNode* dest);
         key_type Move1Cell(BPlusTreeNode* dest);
-        void Update(const key_type& old_key, const key_type& new_key);
-        void Update(const key_type& new_key);
         bool Insert(key_type key, mapped_type value);
-        bool Insert(const key_type& key, const std::vector<BPlusTreeNode*>& children);
-        void InsertKeys(const std::vector<key_type>& keys);
-        bool Erase(key_type key);
+        bool Insert(const key_type& key, std::initializer_list<BPlusTreeNode*> children);
+        void Append(key_type key, mapped_type value);
+        void AppendKey(key_type key);
+        void AppendChild(BPlusTreeNode* child);
+        key_type ReplaceKey(size_type index, key_type key);
+        bool Erase(key_view_type key);
         void Erase(const size_type& start, const size_type& end);
         void EraseKeyByIndex(size_type index);
         void EraseKeys(const size_type& start, const size_type& end);
         void EraseValues(const size_type& start, const size_type& end);
         void EraseChildren(const size_type& start, const size_type& end);
-        void EraseChild(const key_type& key);
         void EraseChildByIndex(size_type index);
+        void ChangeChildCount(const BPlusTreeNode* child, bool increase) noexcept;
+        void UpdateChildCount(size_type index) noexcept;
+        void CompressPrefix();
+
+    private:
+        BPlusTreeNode(bool leaf, size_type order);
+
+        void ShareCommonPrefix_(BPlusTreeNode* other);
+        void ShortenPrefix_(size_type length);
+        static void StripPrefix_(key_type& key, size_type length);
+        static size_type CommonPrefixLength_(key_view_type lhs, key_view_type rhs) noexcept;
+
+        void InsertHint_(size_type index);
+        void EraseHint_(size_type index);
+        void UpdateHints_();
+        template<class T>
+        T* StorageAt_(size_type offset) noexcept;
+        [[nodiscard]] static size_type HintsOffset_() noexcept;
+        [[nodiscard]] static size_type KeysOffset_(size_type order) noexcept;
+        [[nodiscard]] static size_type TailOffset_(bool leaf, size_type order) noexcept;
+        [[nodiscard]] static size_type CountsOffset_(size_type order) noexcept;
+        [[nodiscard]] static size_type AlignUp_(size_type offset, size_type alignment) noexcept;
 
     private:
         bool leaf_{ false };
-        std::vector<key_type> keys_;
-        std::vector<mapped_type> values_;
-        std::vector<BPlusTreeNode*> children_;
         BPlusTreeNode* parent_{ nullptr };
         BPlusTreeNode* left_{ nullptr };
         BPlusTreeNode* right_{ nullptr };
+        key_type prefix_{};
+        InlineArray<hint_type> hints_;
+        InlineArray<key_type> keys_;
+        InlineArray<mapped_type> values_;
+        InlineArray<BPlusTreeNode*> children_;
+        InlineArray<size_type> counts_;
     };
     using Node = BPlusTreeNode;
 
+public:
+    static constexpr size_type kCacheLineSize{ 64 };
+    // The default order fills internal nodes of about kDefaultNodeLines cache lines.
+    static constexpr size_type kDefaultNodeLines{ 16 };
+    static constexpr size_type kDefaultOrder{ std::max<size_type>(3, kDefaultNodeLines * kCacheLineSize / (sizeof(key_type) + sizeof(Node*))) };
+    // Bulk loaded nodes are left partly empty, so that the first inserts do not split them.
+    static constexpr double kDefaultFillFactor{ 0.75 };
+
 public:
     BPlusTree();
     explicit BPlusTree(size_type order);
+    BPlusTree(size_type order, ErasePolicy policy);
     ~BPlusTree();
 
-    bool Insert(const key_type& key, const mapped_type& value) override;
-    mapped_type& GetValue(const key_type& key) override;
-    bool Erase(const key_type& key) override;
+    bool Insert(key_type key, mapped_type value) override;
+    mapped_type& GetValue(key_view_type key) override;
+    bool Exists(key_view_type key) override;
+    bool Erase(key_view_type key) override;
     std::vector<std::pair<key_type, mapped_type>> ShowAll() override;
+    ScanResult Scan(const ScanCursor& cursor, size_type count) override;
+    std::vector<std::pair<key_type, mapped_type>> RangeScan(key_view_type lower, key_view_type upper, size_type limit) override;
+    std::vector<std::pair<key_type, mapped_type>> PrefixScan(key_view_type prefix, size_type limit) override;
+    [[nodiscard]] size_type Size() const override;
+    [[nodiscard]] size_type NumLeaves() const noexcept;
+    size_type BulkLoad(std::vector<std::pair<key_type, mapped_type>> entries) override;
+    size_type BulkLoad(std::vector<std::pair<key_type, mapped_type>> entries, double fill_factor);
+    size_type Rank(key_view_type key) override;
+    std::pair<key_type, mapped_type> Select(size_type index) override;
+    size_type CountRange(key_view_type lower, key_view_type upper) override;
+    // Rebuilds the tree with nodes filled as by BulkLoad and gives unused node memory back.
+    void Compact();
 
 private:
-    [[nodiscard]] bool AreRelatives_(Node* first_node, Node* second_node) const noexcept;
-    [[nodiscard]] bool PossibleToBorrow_(Node* borrowed_node) const noexcept;
-    [[nodiscard]] bool PossibleToBorrow_(Node* borrowing_node, Node* borrowed_node) const noexcept;
-    [[nodiscard]] bool PossibleToMerge_(Node* first_node, Node* second_node) const noexcept;
-
-    void UpdateInternalNodeIndices(Node* internal_node, const key_type& key);
     std::pair<Node*, key_type> Split_(Node* node);
-    void Merge_(Node* node);
-    Node* FindNodeToMerge_(Node* node);
-    key_type FindKeyConnecting2Nodes_(Node* first_node, Node* second_node);
-    void UnlinkFromParentNode_(Node* node);
+    void Rebalance_(Node* node);
+    void Borrow_(Node* borrowing_node, Node* borrowed_node, size_type separator_index);
+    void Merge_(Node* left_node, Node* right_node, size_type separator_index);
     void UnlinkFromNeighbors_(Node* node);
-    bool Exists_(const key_type& key);
-    void Borrow_(Node* borrowing_node);
-    Node* FindNodeToBorrow_(Node* borrowing_node);
-    Node* FindLeaf_(const key_type& key);
-    std::pair<Node*, Node*> FindLeafNodeWithInternalNode_(const key_type& key);
-    key_type GetMinKey_(Node* node);
-    void Clear_(Node* node);
+    static key_type Separator_(const key_type& left, key_type right);
+    static std::vector<size_type> GroupSizes_(size_type count, size_type capacity, size_type minimum, double fill_factor);
+    template<class Predicate>
+    std::vector<std::pair<key_type, mapped_type>> ScanWhile_(key_view_type lower, size_type limit, Predicate predicate);
+    Node* FindLeaf_(key_view_type key);
+    // The number of keys less than key, or not greater than it if inclusive.
+    size_type CountBefore_(key_view_type key, bool inclusive);
+    void UpdatePathCounts_(Node* node, bool increase) noexcept;
+    Node* FindFirstLeaf_() const noexcept;
+    Node* CreateNode_(bool leaf);
+    void DestroyNode_(Node* node) noexcept;
+    // Runs the destructors of node and everything below it; the memory stays in the arenas.
+    void Clear_(Node* node) noexcept;
 
 private:
     Node* root_{ nullptr };
-    size_type order_{ 3 };
-    size_type min_count_keys_{ 1 };
-    size_type max_count_keys_{ 2 };
+    size_type order_;
+    size_type min_count_keys_;
+    size_type max_count_keys_;
+    // Erase rebalances nodes with fewer keys than this: min_count_keys_ unless the policy is kLazy.
+    size_type rebalance_count_keys_;
+    size_type num_elements_{ 0 };
+    SlabArena leaf_arena_;
+    SlabArena inner_arena_;
 };
 
 } // namespace s21
@@ -6,35 +6,47 @@
 namespace s21
 {
 
-template<class Key, class Tp>
-BPlusTree<Key, Tp>::BPlusTree()
-    : root_(new Node(true))
+template<class Key, class Tp, class Search, bool CompressKeys>
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTree()
+    : BPlusTree(kDefaultOrder)
 {}
 
-template<class Key, class Tp>
-BPlusTree<Key, Tp>::BPlusTree(size_type order)
+template<class Key, class Tp, class Search, bool CompressKeys>
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTree(size_type order)
+    : BPlusTree(order, ErasePolicy::kEager)
+{}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTree(size_type order, ErasePolicy policy)
     : order_(order)
     , min_count_keys_(std::ceil(order / 2.0) - 1)
     , max_count_keys_(order - 1)
+    , rebalance_count_keys_(policy == ErasePolicy::kLazy ? std::max<size_type>(1, min_count_keys_ / 4) : min_count_keys_)
+    , leaf_arena_(Node::AllocationSize(true, order), kCacheLineSize)
+    , inner_arena_(Node::AllocationSize(false, order), kCacheLineSize)
 {
     if (order_ <= 2)
     {
         throw std::invalid_argument("The order of the tree cannot be less than or equal to 2.");
     }
-    root_ = new Node(true);
+    root_ = CreateNode_(true);
 }
 
-template<class Key, class Tp>
-BPlusTree<Key, Tp>::~BPlusTree()
+template<class Key, class Tp, class Search, bool CompressKeys>
+BPlusTree<Key, Tp, Search, CompressKeys>::~BPlusTree()
 {
-    Clear_(root_);
+    if constexpr (!std::is_trivially_destructible_v<key_type> || !std::is_trivially_destructible_v<mapped_type>)
+    {
+        Clear_(root_);
+    }
 }
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::Insert(const key_type& key, const mapped_type& value)
+template<class Key, class Tp, class Search, bool CompressKeys>
+bool BPlusTree<Key, Tp, Search, CompressKeys>::Insert(key_type key, mapped_type value)
 {
-    if (auto node = FindLeaf_(key); node->Insert(key, value))
+    if (auto node = FindLeaf_(key); node->Insert(std::move(key), std::move(value)))
     {
+        UpdatePathCounts_(node, true);
         while (node->Size() == order_)
         {
             auto [new_node, middle_key] = Split_(node);
@@ -46,7 +58,7 @@ bool BPlusTree<Key, Tp>::Insert(const key_type& key, const mapped_type& value)
 
             if (node == root_)
             {
-                root_ = new Node(false);
+                root_ = CreateNode_(false);
                 root_->Insert(middle_key, { new_node, node });
                 new_node->SetParent(root_);
                 node->SetParent(root_);
@@ -59,15 +71,15 @@ bool BPlusTree<Key, Tp>::Insert(const key_type& key, const mapped_type& value)
             }
         }
 
-        assert(Exists_(key));
+        ++num_elements_;
         return true;
     }
 
     return false;
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::mapped_type& BPlusTree<Key, Tp>::GetValue(const key_type& key)
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::mapped_type& BPlusTree<Key, Tp, Search, CompressKeys>::GetValue(key_view_type key)
 {
     auto node = FindLeaf_(key);
     auto index = node->GetKeyIndex(key);
@@ -80,147 +92,300 @@ typename BPlusTree<Key, Tp>::mapped_type& BPlusTree<Key, Tp>::GetValue(const key
     throw std::runtime_error("The value was not found.");
 }
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::Erase(const key_type& key)
+template<class Key, class Tp, class Search, bool CompressKeys>
+bool BPlusTree<Key, Tp, Search, CompressKeys>::Exists(key_view_type key)
 {
-    auto [leaf_node, internal_node] = FindLeafNodeWithInternalNode_(key);
-
-    if (leaf_node->Exists(key))
-    {
-        auto leaf_node_size = leaf_node->Size();
+    return FindLeaf_(key)->Exists(key);
+}
 
-        if (leaf_node_size > min_count_keys_)
-        {
-            leaf_node->Erase(key);
-            UpdateInternalNodeIndices(internal_node, key);
-        }
-        else if (leaf_node_size == min_count_keys_)
-        {
-            if (PossibleToBorrow_(leaf_node))
-            {
-                leaf_node->Erase(key);
-                Borrow_(leaf_node);
-                UpdateInternalNodeIndices(internal_node, key);
-            }
-            else
-            {
-                auto parent = leaf_node->GetParent();
-
-                UnlinkFromParentNode_(leaf_node);
-                UnlinkFromNeighbors_(leaf_node);
-                leaf_node->Erase(key);
-                if (leaf_node != root_)
-                {
-                    delete leaf_node;
-                }
-
-                while (parent && (parent->Children().size() != parent->Keys().size() + 1 || parent->Size() == 0))
-                {
-                    if (parent == root_)
-                    {
-                        auto new_root = parent->Children().front();
-                        delete root_;
-                        root_ = new_root;
-                        root_->SetParent(nullptr);
-                        break;
-                    }
-
-                    if (PossibleToBorrow_(parent))
-                    {
-                        Borrow_(parent);
-                        break;
-                    }
-                    else
-                    {
-                        Merge_(parent);
-                        parent = parent->GetParent();
-                    }
-                }
-
-                internal_node = FindLeafNodeWithInternalNode_(key).second;
-                UpdateInternalNodeIndices(internal_node, key);
-            }
-        }
+template<class Key, class Tp, class Search, bool CompressKeys>
+bool BPlusTree<Key, Tp, Search, CompressKeys>::Erase(key_view_type key)
+{
+    auto leaf_node = FindLeaf_(key);
 
-        assert(!Exists_(key));
+    if (leaf_node->Erase(key))
+    {
+        UpdatePathCounts_(leaf_node, false);
+        Rebalance_(leaf_node);
+        --num_elements_;
+        assert(!Exists(key));
         return true;
     }
 
     return false;
 }
 
-template<class Key, class Tp>
-std::vector<std::pair<typename BPlusTree<Key, Tp>::key_type, typename BPlusTree<Key, Tp>::mapped_type>>
-BPlusTree<Key, Tp>::ShowAll()
+template<class Key, class Tp, class Search, bool CompressKeys>
+std::vector<std::pair<typename BPlusTree<Key, Tp, Search, CompressKeys>::key_type, typename BPlusTree<Key, Tp, Search, CompressKeys>::mapped_type>>
+BPlusTree<Key, Tp, Search, CompressKeys>::ShowAll()
 {
     std::vector<std::pair<key_type, mapped_type>> entries;
-    auto node = root_;
 
-    while (!node->IsLeaf())
+    for (auto node = FindFirstLeaf_(); node != nullptr; node = node->GetRight())
     {
-        node = node->Children().front();
+        const auto& values = node->Values();
+
+        for (size_type i = 0; i < node->Size(); ++i)
+        {
+            entries.push_back({ node->KeyAt(i), values[i] });
+        }
     }
 
-    for (; node != nullptr; node = node->GetRight())
+    return entries;
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::ScanResult BPlusTree<Key, Tp, Search, CompressKeys>::Scan(const ScanCursor& cursor, size_type count)
+{
+    ScanResult result;
+
+    if (cursor.finished)
     {
-        auto keys = node->Keys();
-        auto values = node->Values();
+        result.cursor.finished = true;
+        return result;
+    }
 
-        for (size_type i = 0; i < node->Size(); ++i)
+    // The cursor keeps the last key returned, so the scan resumes after it even if
+    // the leaves were split or merged in between.
+    auto node = FindFirstLeaf_();
+    size_type index = 0;
+
+    if (cursor.last_key)
+    {
+        node = FindLeaf_(*cursor.last_key);
+        index = node->GetKeyIndex(*cursor.last_key);
+        if (node->Exists(*cursor.last_key, index))
         {
-            entries.push_back({ keys[i], values[i] });
+            ++index;
         }
     }
 
-    return entries;
+    while (node != nullptr && (index == node->Size() || result.entries.size() < count))
+    {
+        if (index == node->Size())
+        {
+            node = node->GetRight();
+            index = 0;
+            continue;
+        }
+
+        result.entries.emplace_back(node->KeyAt(index), node->Values()[index]);
+        ++index;
+    }
+
+    result.cursor.finished = (node == nullptr);
+    result.cursor.last_key = result.entries.empty() ? cursor.last_key : result.entries.back().first;
+
+    return result;
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+std::vector<std::pair<typename BPlusTree<Key, Tp, Search, CompressKeys>::key_type, typename BPlusTree<Key, Tp, Search, CompressKeys>::mapped_type>>
+BPlusTree<Key, Tp, Search, CompressKeys>::RangeScan(key_view_type lower, key_view_type upper, size_type limit)
+{
+    return ScanWhile_(lower, limit, [&upper](const key_type& key)
+    {
+        return !(upper < key);
+    });
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+std::vector<std::pair<typename BPlusTree<Key, Tp, Search, CompressKeys>::key_type, typename BPlusTree<Key, Tp, Search, CompressKeys>::mapped_type>>
+BPlusTree<Key, Tp, Search, CompressKeys>::PrefixScan(key_view_type prefix, size_type limit)
+{
+    return ScanWhile_(prefix, limit, [&prefix](const key_type& key)
+    {
+        return OrderedKeyValueStorageInterface<Key, Tp>::HasPrefix(key, prefix);
+    });
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::size_type BPlusTree<Key, Tp, Search, CompressKeys>::Size() const
+{
+    return num_elements_;
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::size_type BPlusTree<Key, Tp, Search, CompressKeys>::NumLeaves() const noexcept
+{
+    size_type num_leaves = 0;
+
+    for (auto node = FindFirstLeaf_(); node != nullptr; node = node->GetRight())
+    {
+        ++num_leaves;
+    }
+
+    return num_leaves;
 }
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::AreRelatives_(Node* first_node, Node* second_node) const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::size_type
+BPlusTree<Key, Tp, Search, CompressKeys>::BulkLoad(std::vector<std::pair<key_type, mapped_type>> entries)
 {
-    return first_node && second_node && first_node->GetParent() == second_node->GetParent();
+    return BulkLoad(std::move(entries), kDefaultFillFactor);
 }
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::PossibleToBorrow_(Node* borrowing_node) const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::size_type
+BPlusTree<Key, Tp, Search, CompressKeys>::BulkLoad(std::vector<std::pair<key_type, mapped_type>> entries, double fill_factor)
 {
-    return
-        PossibleToBorrow_(borrowing_node, borrowing_node->GetLeft()) ||
-        PossibleToBorrow_(borrowing_node, borrowing_node->GetRight());
+    if (fill_factor <= 0 || fill_factor > 1)
+    {
+        throw std::invalid_argument("The fill factor must be greater than 0 and not greater than 1.");
+    }
+
+    auto unsorted = std::adjacent_find(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs)
+    {
+        return !(lhs.first < rhs.first);
+    });
+
+    if (num_elements_ != 0 || unsorted != entries.end())
+    {
+        return KeyValueStorageInterface<Key, Tp>::BulkLoad(std::move(entries));
+    }
+    if (entries.empty())
+    {
+        return 0;
+    }
+
+    // The leaves are filled first, then one level of internal nodes at a time until
+    // a single node is left. separators[i] is not greater than any key under level[i]
+    // and greater than every key under level[i - 1].
+    std::vector<Node*> level;
+    std::vector<key_type> separators;
+    size_type position = 0;
+
+    for (auto size : GroupSizes_(entries.size(), max_count_keys_, min_count_keys_, fill_factor))
+    {
+        auto leaf = CreateNode_(true);
+
+        for (auto end = position + size; position < end; ++position)
+        {
+            leaf->Append(std::move(entries[position].first), std::move(entries[position].second));
+        }
+        if (level.empty())
+        {
+            separators.push_back(leaf->KeyAt(0));
+        }
+        else
+        {
+            level.back()->SetRight(leaf);
+            leaf->SetLeft(level.back());
+            separators.push_back(Separator_(level.back()->KeyAt(level.back()->Size() - 1), leaf->KeyAt(0)));
+        }
+        leaf->CompressPrefix();
+        level.push_back(leaf);
+    }
+
+    while (level.size() > 1)
+    {
+        std::vector<Node*> parents;
+        std::vector<key_type> parent_separators;
+        position = 0;
+
+        for (auto size : GroupSizes_(level.size(), order_, min_count_keys_ + 1, fill_factor))
+        {
+            auto parent = CreateNode_(false);
+            auto end = position + size;
+
+            parent_separators.push_back(std::move(separators[position]));
+            parent->AppendChild(level[position]);
+            for (++position; position < end; ++position)
+            {
+                parent->AppendKey(std::move(separators[position]));
+                parent->AppendChild(level[position]);
+            }
+            if (!parents.empty())
+            {
+                parents.back()->SetRight(parent);
+                parent->SetLeft(parents.back());
+            }
+            parents.push_back(parent);
+        }
+
+        level = std::move(parents);
+        separators = std::move(parent_separators);
+    }
+
+    DestroyNode_(root_);
+    root_ = level.front();
+    num_elements_ = entries.size();
+
+    return num_elements_;
 }
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::PossibleToBorrow_(Node* borrowing_node, Node* borrowed_node) const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::size_type BPlusTree<Key, Tp, Search, CompressKeys>::Rank(key_view_type key)
 {
-    return AreRelatives_(borrowing_node, borrowed_node) && borrowed_node->Size() > min_count_keys_;
+    return CountBefore_(key, false);
 }
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::PossibleToMerge_(Node* first_node, Node* second_node) const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+std::pair<typename BPlusTree<Key, Tp, Search, CompressKeys>::key_type, typename BPlusTree<Key, Tp, Search, CompressKeys>::mapped_type>
+BPlusTree<Key, Tp, Search, CompressKeys>::Select(size_type index)
 {
-    return AreRelatives_(first_node, second_node) && (first_node->Size() + second_node->Size() <= max_count_keys_);
+    if (index >= num_elements_)
+    {
+        throw std::out_of_range("The index is out of range.");
+    }
+
+    auto node = root_;
+    while (!node->IsLeaf())
+    {
+        const auto& counts = node->ChildCounts();
+        size_type child = 0;
+
+        for (; index >= counts[child]; ++child)
+        {
+            index -= counts[child];
+        }
+        node = node->Children()[child];
+    }
+
+    return { node->KeyAt(index), node->Values()[index] };
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::UpdateInternalNodeIndices(Node* internal_node, const key_type& key)
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::size_type BPlusTree<Key, Tp, Search, CompressKeys>::CountRange(key_view_type lower, key_view_type upper)
 {
-    if (internal_node && internal_node->Exists(key))
+    if (upper < lower)
     {
-        auto index = internal_node->GetKeyIndex(key);
-        auto min_key = GetMinKey_(internal_node->Children().at(index + 1));
+        return 0;
+    }
+
+    return CountBefore_(upper, true) - CountBefore_(lower, false);
+}
 
-        internal_node->Update(key, min_key);
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::Compact()
+{
+    std::vector<std::pair<key_type, mapped_type>> entries;
+
+    entries.reserve(num_elements_);
+    for (auto node = FindFirstLeaf_(); node != nullptr; node = node->GetRight())
+    {
+        auto& values = node->Values();
+        for (size_type i = 0; i < node->Size(); ++i)
+        {
+            entries.emplace_back(node->KeyAt(i), std::move(values[i]));
+        }
     }
+
+    Clear_(root_);
+    leaf_arena_.Release();
+    inner_arena_.Release();
+    root_ = CreateNode_(true);
+    num_elements_ = 0;
+    BulkLoad(std::move(entries));
 }
 
-template<class Key, class Tp>
-std::pair<typename BPlusTree<Key, Tp>::Node*, typename BPlusTree<Key, Tp>::key_type>
-BPlusTree<Key, Tp>::Split_(Node* node)
+template<class Key, class Tp, class Search, bool CompressKeys>
+std::pair<typename BPlusTree<Key, Tp, Search, CompressKeys>::Node*, typename BPlusTree<Key, Tp, Search, CompressKeys>::key_type>
+BPlusTree<Key, Tp, Search, CompressKeys>::Split_(Node* node)
 {
     static constexpr auto GetMiddleKey = [](Node* node) -> key_type
     {
-        auto keys = node->Keys();
-        return keys.at(keys.size() / 2);
+        return node->KeyAt(node->Size() / 2);
     };
     static constexpr auto InsertNewNode = [](Node* new_node, Node* node) -> void
     {
@@ -234,93 +399,111 @@ BPlusTree<Key, Tp>::Split_(Node* node)
         new_node->SetParent(node_parent);
     };
 
-    auto new_node = new Node(node->IsLeaf());
+    auto new_node = CreateNode_(node->IsLeaf());
     auto middle_key = GetMiddleKey(node);
 
     InsertNewNode(new_node, node);
     node->MoveCells(new_node, middle_key);
 
+    if (node->IsLeaf())
+    {
+        middle_key = Separator_(new_node->KeyAt(new_node->Size() - 1), std::move(middle_key));
+    }
+
     return { new_node, middle_key };
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::Merge_(Node* node)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::Rebalance_(Node* node)
 {
-    static constexpr auto UnlinkFromParentNode = [](Node* node, const key_type& parent_key) -> void
+    // Separators are left as they are when a key is erased: a separator only has to
+    // split its children's key ranges, it does not have to be a key of the tree.
+    // A sibling that cannot lend a key holds at most min_count_keys_, so with the
+    // lower lazy threshold the two still fit in one node.
+    while (node != root_ && node->Size() < rebalance_count_keys_)
     {
-        if (auto parent = node->GetParent(); parent)
+        auto parent = node->GetParent();
+        auto& children = parent->Children();
+        auto index = static_cast<size_type>(std::distance(children.begin(), std::find(children.begin(), children.end(), node)));
+        auto left_node = index > 0 ? children[index - 1] : nullptr;
+        auto right_node = index + 1 < children.size() ? children[index + 1] : nullptr;
+
+        if (left_node && left_node->Size() > min_count_keys_)
         {
-            auto [key_index, child_index] = parent->GetKeyChildIndex(parent_key, node);
-            parent->EraseKeyByIndex(key_index);
-            parent->EraseChildByIndex(child_index);
+            Borrow_(node, left_node, index - 1);
+            return;
+        }
+        if (right_node && right_node->Size() > min_count_keys_)
+        {
+            Borrow_(node, right_node, index);
+            return;
         }
-    };
 
-    if (auto second_node = FindNodeToMerge_(node); second_node)
-    {
-        auto key_connecting_2_nodes = FindKeyConnecting2Nodes_(node, second_node);
-        node->InsertKeys({ key_connecting_2_nodes });
-        second_node->MoveAllCells(node);
-        UnlinkFromParentNode(second_node, key_connecting_2_nodes);
-        UnlinkFromNeighbors_(second_node);
-        delete second_node;
+        if (left_node)
+        {
+            Merge_(left_node, node, index - 1);
+        }
+        else
+        {
+            Merge_(node, right_node, index);
+        }
+        node = parent;
     }
-}
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::Node* BPlusTree<Key, Tp>::FindNodeToMerge_(Node* node)
-{
-    if (auto left_node = node->GetLeft(); PossibleToMerge_(node, left_node))
+    if (node == root_ && !root_->IsLeaf() && root_->Size() == 0)
     {
-        return left_node;
+        root_ = node->Children().front();
+        root_->SetParent(nullptr);
+        node->Children().clear();
+        DestroyNode_(node);
     }
-    else if (auto right_node = node->GetRight(); PossibleToMerge_(node, right_node))
-    {
-        return right_node;
-    }
-    return nullptr;
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::key_type
-BPlusTree<Key, Tp>::FindKeyConnecting2Nodes_(Node* first_node, Node* second_node)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::Borrow_(Node* borrowing_node, Node* borrowed_node, size_type separator_index)
 {
-    auto parent = first_node->GetParent();
-    auto min_key = first_node->Keys().front();
-    auto index = parent->GetKeyIndex(min_key);
+    auto parent = borrowing_node->GetParent();
+    auto from_right = (borrowing_node->GetRight() == borrowed_node);
+
+    borrowed_node->Move1Cell(borrowing_node);
 
-    if (first_node->GetLeft() == second_node && !parent->Exists(min_key, index))
+    if (borrowing_node->IsLeaf())
     {
-        --index;
+        auto left_node = from_right ? borrowing_node : borrowed_node;
+        auto right_node = from_right ? borrowed_node : borrowing_node;
+
+        parent->ReplaceKey(separator_index, Separator_(left_node->KeyAt(left_node->Size() - 1), right_node->KeyAt(0)));
     }
-    else if (first_node->GetRight() == second_node && parent->Exists(min_key, index))
+    else
     {
-        ++index;
+        // The moved key goes up and the separator comes down to the borrowing node.
+        auto moved_key_index = from_right ? borrowing_node->Size() - 1 : 0;
+        parent->ReplaceKey(separator_index, borrowing_node->ReplaceKey(moved_key_index, parent->Keys()[separator_index]));
     }
 
-    return parent->Keys().at(index);
+    parent->UpdateChildCount(separator_index);
+    parent->UpdateChildCount(separator_index + 1);
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::UnlinkFromParentNode_(Node* node)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::Merge_(Node* left_node, Node* right_node, size_type separator_index)
 {
-    if (auto parent = node->GetParent(); parent)
-    {
-        auto parent_key = node->Keys().front();
-        auto [key_index, child_index] = parent->GetKeyChildIndex(parent_key, node);
-
-        if (!parent->Exists(parent_key, key_index) && key_index != 0)
-        {
-            --key_index;
-        }
+    auto parent = left_node->GetParent();
 
-        parent->EraseKeyByIndex(key_index);
-        parent->EraseChildByIndex(child_index);
+    if (!left_node->IsLeaf())
+    {
+        left_node->AppendKey(parent->Keys()[separator_index]);
     }
+    right_node->MoveAllCells(left_node);
+    parent->EraseKeyByIndex(separator_index);
+    parent->EraseChildByIndex(separator_index + 1);
+    parent->UpdateChildCount(separator_index);
+    UnlinkFromNeighbors_(right_node);
+    DestroyNode_(right_node);
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::UnlinkFromNeighbors_(Node* node)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::UnlinkFromNeighbors_(Node* node)
 {
     auto left_node = node->GetLeft();
     auto right_node = node->GetRight();
@@ -335,57 +518,94 @@ void BPlusTree<Key, Tp>::UnlinkFromNeighbors_(Node* node)
     }
 }
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::Exists_(const key_type& key)
+// The shortest prefix of right that is still greater than left. Any key between
+// the two leaves splits them, so internal nodes keep only as much of the key as
+// the search needs.
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::key_type BPlusTree<Key, Tp, Search, CompressKeys>::Separator_(const key_type& left, key_type right)
 {
-    auto [leaf_node, internal_node] = FindLeafNodeWithInternalNode_(key);
-    return (leaf_node && leaf_node->Exists(key)) || (internal_node && internal_node->Exists(key));
+    if constexpr (CompressKeys)
+    {
+        auto length = std::mismatch(left.begin(), left.end(), right.begin(), right.end()).second - right.begin() + 1;
+        if (static_cast<size_type>(length) < right.size())
+        {
+            right.resize(length);
+            right.shrink_to_fit();
+        }
+    }
+
+    return right;
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::Borrow_(Node* borrowing_node)
+template<class Key, class Tp, class Search, bool CompressKeys>
+std::vector<typename BPlusTree<Key, Tp, Search, CompressKeys>::size_type>
+BPlusTree<Key, Tp, Search, CompressKeys>::GroupSizes_(size_type count, size_type capacity, size_type minimum, double fill_factor)
 {
-    if (Node* borrowed_node = FindNodeToBorrow_(borrowing_node); borrowed_node)
+    if (count == 0)
     {
-        auto key_connecting_2_nodes = FindKeyConnecting2Nodes_(borrowing_node, borrowed_node);
-        auto borrowed_key = borrowed_node->Move1Cell(borrowing_node);
-        auto parent = borrowing_node->GetParent();
+        return {};
+    }
 
-        if (borrowing_node->IsLeaf())
-        {
-            auto new_key_connecting_2_nodes = (borrowing_node->GetRight() == borrowed_node) ? borrowed_node->Keys().front() : borrowed_key;
-            parent->Update(key_connecting_2_nodes, new_key_connecting_2_nodes);
-        }
-        else
+    // The fill factor sets the number of groups. There are never so many that a group
+    // gets less than minimum items, and with evened out sizes that many always fit.
+    auto target = std::clamp<size_type>(static_cast<size_type>(std::llround(capacity * fill_factor)), 1, capacity);
+    auto num_groups = (count + target - 1) / target;
+    num_groups = std::min(num_groups, std::max<size_type>(1, count / std::max<size_type>(1, minimum)));
+    std::vector<size_type> sizes(num_groups, count / num_groups);
+
+    std::fill(sizes.begin(), sizes.begin() + count % num_groups, count / num_groups + 1);
+
+    return sizes;
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+template<class Predicate>
+std::vector<std::pair<typename BPlusTree<Key, Tp, Search, CompressKeys>::key_type, typename BPlusTree<Key, Tp, Search, CompressKeys>::mapped_type>>
+BPlusTree<Key, Tp, Search, CompressKeys>::ScanWhile_(key_view_type lower, size_type limit, Predicate predicate)
+{
+    std::vector<std::pair<key_type, mapped_type>> entries;
+    auto node = FindLeaf_(lower);
+    auto index = node->GetKeyIndex(lower);
+
+    // Only the leaves holding the range are visited, following the right links.
+    for (; node != nullptr; node = node->GetRight(), index = 0)
+    {
+        for (; index < node->Size(); ++index)
         {
-            parent->Update(key_connecting_2_nodes, borrowed_key);
-            borrowing_node->Update(borrowed_key, key_connecting_2_nodes);
+            auto key = node->KeyAt(index);
+
+            if ((limit != 0 && entries.size() == limit) || !predicate(key))
+            {
+                return entries;
+            }
+            entries.emplace_back(std::move(key), node->Values()[index]);
         }
     }
+
+    return entries;
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::Node* BPlusTree<Key, Tp>::FindNodeToBorrow_(Node* borrowing_node)
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::Node* BPlusTree<Key, Tp, Search, CompressKeys>::FindFirstLeaf_() const noexcept
 {
-    if (auto left_node = borrowing_node->GetLeft(); PossibleToBorrow_(borrowing_node, left_node))
-    {
-        return left_node;
-    }
-    else if (auto right_node = borrowing_node->GetRight(); PossibleToBorrow_(borrowing_node, right_node))
+    auto node = root_;
+
+    while (!node->IsLeaf())
     {
-        return right_node;
+        node = node->Children().front();
     }
-    return nullptr;
+
+    return node;
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::Node* BPlusTree<Key, Tp>::FindLeaf_(const key_type& key)
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::Node* BPlusTree<Key, Tp, Search, CompressKeys>::FindLeaf_(key_view_type key)
 {
     auto node = root_;
 
     while (!node->IsLeaf())
     {
-        auto children = node->Children();
+        const auto& children = node->Children();
         auto index = node->GetKeyIndex(key);
 
         if (node->Exists(key, index))
@@ -399,52 +619,59 @@ typename BPlusTree<Key, Tp>::Node* BPlusTree<Key, Tp>::FindLeaf_(const key_type&
     return node;
 }
 
-template<class Key, class Tp>
-std::pair<typename BPlusTree<Key, Tp>::Node*, typename BPlusTree<Key, Tp>::Node*>
-BPlusTree<Key, Tp>::FindLeafNodeWithInternalNode_(const key_type& key)
+// Descends as FindLeaf_ does and adds up the children left of the path.
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::size_type BPlusTree<Key, Tp, Search, CompressKeys>::CountBefore_(key_view_type key, bool inclusive)
 {
     auto node = root_;
-    Node* internal_node = nullptr;
-
-    if (!root_->IsLeaf() && node->Exists(key))
-    {
-        internal_node = node;
-    }
+    size_type count = 0;
 
     while (!node->IsLeaf())
     {
-        auto children = node->Children();
+        const auto& counts = node->ChildCounts();
         auto index = node->GetKeyIndex(key);
 
         if (node->Exists(key, index))
         {
             ++index;
-            internal_node = node;
         }
 
-        node = children.at(index);
+        count = std::accumulate(counts.begin(), counts.begin() + index, count);
+        node = node->Children()[index];
     }
 
-    return { node, internal_node };
+    auto index = node->GetKeyIndex(key);
+    return count + index + (inclusive && node->Exists(key, index) ? 1 : 0);
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::key_type BPlusTree<Key, Tp>::GetMinKey_(Node* node)
+// Every internal node on the way from node to the root counts one entry more or less under it.
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::UpdatePathCounts_(Node* node, bool increase) noexcept
 {
-    while (!node->IsLeaf())
+    for (auto parent = node->GetParent(); parent != nullptr; node = parent, parent = parent->GetParent())
     {
-        node = node->Children().front();
+        parent->ChangeChildCount(node, increase);
     }
+}
 
-    return node->Keys().front();
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::Node* BPlusTree<Key, Tp, Search, CompressKeys>::CreateNode_(bool leaf)
+{
+    return Node::Create(leaf ? leaf_arena_ : inner_arena_, leaf, order_);
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::DestroyNode_(Node* node) noexcept
+{
+    Node::Destroy(node->IsLeaf() ? leaf_arena_ : inner_arena_, node);
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::Clear_(Node* node)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::Clear_(Node* node) noexcept
 {
     auto& children = node->Children();
     std::for_each(children.begin(), children.end(), [&](auto& child){ Clear_(child); });
-    delete node;
+    node->~Node();
 }
 
 } // namespace s21
@@ -4,95 +4,146 @@
 namespace s21
 {
 
-template<class Key, class Tp>
-BPlusTree<Key, Tp>::BPlusTreeNode::BPlusTreeNode(bool leaf)
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode* BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Create(SlabArena& arena, bool leaf, size_type order)
+{
+    auto memory = arena.Allocate();
+    return ::new (memory) BPlusTreeNode(leaf, order);
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Destroy(SlabArena& arena, BPlusTreeNode* node) noexcept
+{
+    node->~BPlusTreeNode();
+    arena.Deallocate(node);
+}
+
+// A node holds at most order keys: it is split as soon as it reaches that size.
+template<class Key, class Tp, class Search, bool CompressKeys>
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::BPlusTreeNode(bool leaf, size_type order)
     : leaf_(leaf)
+    , hints_(Search::kUsesHints ? StorageAt_<hint_type>(HintsOffset_()) : nullptr, Search::kUsesHints ? order : 0)
+    , keys_(StorageAt_<key_type>(KeysOffset_(order)), order)
+    , values_(leaf ? StorageAt_<mapped_type>(TailOffset_(leaf, order)) : nullptr, leaf ? order : 0)
+    , children_(leaf ? nullptr : StorageAt_<BPlusTreeNode*>(TailOffset_(leaf, order)), leaf ? 0 : order + 1)
+    , counts_(leaf ? nullptr : StorageAt_<size_type>(CountsOffset_(order)), leaf ? 0 : order + 1)
 {}
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::BPlusTreeNode::IsLeaf() const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+bool BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::IsLeaf() const noexcept
 {
     return leaf_;
 }
 
-template<class Key, class Tp>
-std::vector<typename BPlusTree<Key, Tp>::BPlusTreeNode::key_type>& BPlusTree<Key, Tp>::BPlusTreeNode::Keys()
+template<class Key, class Tp, class Search, bool CompressKeys>
+const InlineArray<typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::key_type>&
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Keys() const noexcept
 {
     return keys_;
 }
 
-template<class Key, class Tp>
-std::vector<typename BPlusTree<Key, Tp>::BPlusTreeNode::mapped_type>& BPlusTree<Key, Tp>::BPlusTreeNode::Values()
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::key_type BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::KeyAt(size_type index) const
+{
+    if constexpr (CompressKeys)
+    {
+        return prefix_ + keys_.at(index);
+    }
+    else
+    {
+        return keys_.at(index);
+    }
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+InlineArray<typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::mapped_type>& BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Values()
 {
     return values_;
 }
 
-template<class Key, class Tp>
-std::vector<typename BPlusTree<Key, Tp>::BPlusTreeNode*>& BPlusTree<Key, Tp>::BPlusTreeNode::Children()
+template<class Key, class Tp, class Search, bool CompressKeys>
+InlineArray<typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode*>& BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Children()
 {
     return children_;
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::BPlusTreeNode::size_type BPlusTree<Key, Tp>::BPlusTreeNode::Size() const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+const InlineArray<typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::size_type>&
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::ChildCounts() const noexcept
 {
-    return keys_.size();
+    return counts_;
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::BPlusTreeNode::size_type
-BPlusTree<Key, Tp>::BPlusTreeNode::GetKeyIndex(const key_type& key) const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::size_type BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Size() const noexcept
 {
-    return std::distance(keys_.begin(), std::lower_bound(keys_.begin(), keys_.end(), key));
+    return keys_.size();
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::BPlusTreeNode::size_type
-BPlusTree<Key, Tp>::BPlusTreeNode::GetChildIndex(const BPlusTreeNode* child) const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::size_type BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Count() const noexcept
 {
-    return std::distance(children_.begin(), std::lower_bound(children_.begin(), children_.end(), child));
+    return leaf_ ? keys_.size() : std::accumulate(counts_.begin(), counts_.end(), size_type{ 0 });
 }
 
-template<class Key, class Tp>
-std::pair<typename BPlusTree<Key, Tp>::BPlusTreeNode::size_type, typename BPlusTree<Key, Tp>::BPlusTreeNode::size_type>
-BPlusTree<Key, Tp>::BPlusTreeNode::GetKeyChildIndex(const key_type& key, const BPlusTreeNode* child) const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::size_type
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::GetKeyIndex(key_view_type key) const noexcept
 {
-    auto key_index = GetKeyIndex(key);
-    return { key_index, children_.at(key_index) == child ? key_index : key_index + 1 };
+    if constexpr (CompressKeys)
+    {
+        // Every key of the node starts with the prefix, so a key that does not is
+        // either before or after all of them.
+        if (auto head = key.substr(0, prefix_.size()); head != prefix_)
+        {
+            return head < prefix_ ? 0 : Size();
+        }
+        key.remove_prefix(prefix_.size());
+    }
+
+    return Search::LowerBound(keys_.begin(), hints_.begin(), keys_.size(), key);
 }
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::BPlusTreeNode::Exists(const key_type& key) const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+bool BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Exists(key_view_type key) const noexcept
 {
     return Exists(key, GetKeyIndex(key));
 }
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::BPlusTreeNode::Exists(const key_type& key, const size_type& index) const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+bool BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Exists(key_view_type key, const size_type& index) const noexcept
 {
-    return index < Size() && keys_.at(index) == key;
+    if constexpr (CompressKeys)
+    {
+        return index < Size() && key.size() == prefix_.size() + keys_[index].size()
+            && key.compare(0, prefix_.size(), prefix_) == 0 && key.substr(prefix_.size()) == keys_[index];
+    }
+    else
+    {
+        return index < Size() && keys_.at(index) == key;
+    }
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::BPlusTreeNode* BPlusTree<Key, Tp>::BPlusTreeNode::GetParent() const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode* BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::GetParent() const noexcept
 {
     return parent_;
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::BPlusTreeNode* BPlusTree<Key, Tp>::BPlusTreeNode::GetLeft() const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode* BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::GetLeft() const noexcept
 {
     return left_;
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::BPlusTreeNode* BPlusTree<Key, Tp>::BPlusTreeNode::GetRight() const noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode* BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::GetRight() const noexcept
 {
     return right_;
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::BPlusTreeNode::mapped_type& BPlusTree<Key, Tp>::BPlusTreeNode::GetValue(const key_type& key)
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::mapped_type& BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::GetValue(key_view_type key)
 {
     auto index = GetKeyIndex(key);
 
@@ -104,40 +155,42 @@ typename BPlusTree<Key, Tp>::BPlusTreeNode::mapped_type& BPlusTree<Key, Tp>::BPl
     throw std::runtime_error("The value was not found.");
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::SetParent(BPlusTreeNode* node) noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::SetParent(BPlusTreeNode* node) noexcept
 {
     parent_ = node;
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::SetLeft(BPlusTreeNode* node) noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::SetLeft(BPlusTreeNode* node) noexcept
 {
     left_ = node;
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::SetRight(BPlusTreeNode* node) noexcept
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::SetRight(BPlusTreeNode* node) noexcept
 {
     right_ = node;
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::MoveCells(BPlusTreeNode* dest, const key_type& limit)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::MoveCells(BPlusTreeNode* dest, const key_type& limit)
 {
     auto index = GetKeyIndex(limit);
 
+    ShareCommonPrefix_(dest);
     if (this->left_ == dest)
     {
-        dest->keys_.insert(dest->keys_.end(), keys_.begin(), keys_.begin() + index);
+        dest->keys_.insert(dest->keys_.end(), std::make_move_iterator(keys_.begin()), std::make_move_iterator(keys_.begin() + index));
         if (IsLeaf())
         {
-            dest->values_.insert(dest->values_.end(), values_.begin(), values_.begin() + index);
+            dest->values_.insert(dest->values_.end(), std::make_move_iterator(values_.begin()), std::make_move_iterator(values_.begin() + index));
             Erase(0, index);
         }
         else
         {
             dest->children_.insert(dest->children_.end(), children_.begin(), children_.begin() + index + 1);
+            dest->counts_.insert(dest->counts_.end(), counts_.begin(), counts_.begin() + index + 1);
             EraseChildren(0, index + 1);
             EraseKeys(0, index);
 
@@ -149,15 +202,16 @@ void BPlusTree<Key, Tp>::BPlusTreeNode::MoveCells(BPlusTreeNode* dest, const key
     }
     else
     {
-        dest->keys_.insert(dest->keys_.begin(), keys_.begin() + index, keys_.end());
+        dest->keys_.insert(dest->keys_.begin(), std::make_move_iterator(keys_.begin() + index), std::make_move_iterator(keys_.end()));
         if (IsLeaf())
         {
-            dest->values_.insert(dest->values_.begin(), values_.begin() + index, values_.end());
+            dest->values_.insert(dest->values_.begin(), std::make_move_iterator(values_.begin() + index), std::make_move_iterator(values_.end()));
             Erase(index, Size());
         }
         else
         {
             dest->children_.insert(dest->children_.begin(), children_.begin() + index, children_.end());
+            dest->counts_.insert(dest->counts_.begin(), counts_.begin() + index, counts_.end());
             EraseChildren(index, Size() + 1);
             EraseKeys(index, Size());
 
@@ -167,26 +221,34 @@ void BPlusTree<Key, Tp>::BPlusTreeNode::MoveCells(BPlusTreeNode* dest, const key
             }
         }
     }
+
+    CompressPrefix();
+    dest->CompressPrefix();
+    UpdateHints_();
+    dest->UpdateHints_();
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::MoveAllCells(BPlusTreeNode* dest)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::MoveAllCells(BPlusTreeNode* dest)
 {
     assert(this->left_ != nullptr || this->right_ != nullptr);
 
     bool is_left = (this->left_ == dest);
 
+    ShareCommonPrefix_(dest);
     auto key_insert_pos = is_left ? dest->keys_.end() : dest->keys_.begin();
-    dest->keys_.insert(key_insert_pos, keys_.begin(), keys_.end());
+    dest->keys_.insert(key_insert_pos, std::make_move_iterator(keys_.begin()), std::make_move_iterator(keys_.end()));
     if (IsLeaf())
     {
         auto value_insert_pos = is_left ? dest->values_.end() : dest->values_.begin();
-        dest->values_.insert(value_insert_pos, values_.begin(), values_.end());
+        dest->values_.insert(value_insert_pos, std::make_move_iterator(values_.begin()), std::make_move_iterator(values_.end()));
     }
     else
     {
         auto children_insert_pos = is_left ? dest->children_.end() : dest->children_.begin();
         dest->children_.insert(children_insert_pos, children_.begin(), children_.end());
+        auto counts_insert_pos = is_left ? dest->counts_.end() : dest->counts_.begin();
+        dest->counts_.insert(counts_insert_pos, counts_.begin(), counts_.end());
 
         for (auto& child : children_)
         {
@@ -197,82 +259,101 @@ void BPlusTree<Key, Tp>::BPlusTreeNode::MoveAllCells(BPlusTreeNode* dest)
     keys_.clear();
     values_.clear();
     children_.clear();
+    counts_.clear();
+    dest->CompressPrefix();
+    UpdateHints_();
+    dest->UpdateHints_();
 }
 
-template<class Key, class Tp>
-typename BPlusTree<Key, Tp>::BPlusTreeNode::key_type BPlusTree<Key, Tp>::BPlusTreeNode::Move1Cell(BPlusTreeNode* dest)
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::key_type BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Move1Cell(BPlusTreeNode* dest)
 {
     bool is_left = (this->left_ == dest);
 
+    ShareCommonPrefix_(dest);
     if (is_left)
     {
-        dest->keys_.insert(dest->keys_.end(), keys_.begin(), keys_.begin() + 1);
+        dest->keys_.insert(dest->keys_.end(), std::make_move_iterator(keys_.begin()), std::make_move_iterator(keys_.begin() + 1));
         keys_.erase(keys_.begin());
 
         if (IsLeaf())
         {
-            dest->values_.insert(dest->values_.end(), values_.begin(), values_.begin() + 1);
+            dest->values_.insert(dest->values_.end(), std::make_move_iterator(values_.begin()), std::make_move_iterator(values_.begin() + 1));
             values_.erase(values_.begin());
         }
         else
         {
             dest->children_.insert(dest->children_.end(), children_.begin(), children_.begin() + 1);
+            dest->counts_.insert(dest->counts_.end(), counts_.begin(), counts_.begin() + 1);
             children_.erase(children_.begin());
+            counts_.erase(counts_.begin());
             dest->children_.back()->SetParent(dest);
         }
 
-        return dest->keys_.back();
+        CompressPrefix();
+        dest->CompressPrefix();
+        UpdateHints_();
+        dest->UpdateHints_();
+
+        return dest->KeyAt(dest->Size() - 1);
     }
     else
     {
-        dest->keys_.insert(dest->keys_.begin(), keys_.end() - 1, keys_.end());
+        dest->keys_.insert(dest->keys_.begin(), std::make_move_iterator(keys_.end() - 1), std::make_move_iterator(keys_.end()));
         keys_.pop_back();
 
         if (IsLeaf())
         {
-            dest->values_.insert(dest->values_.begin(), values_.end() - 1, values_.end());
+            dest->values_.insert(dest->values_.begin(), std::make_move_iterator(values_.end() - 1), std::make_move_iterator(values_.end()));
             values_.pop_back();
         }
         else
         {
             dest->children_.insert(dest->children_.begin(), children_.end() - 1, children_.end());
+            dest->counts_.insert(dest->counts_.begin(), counts_.end() - 1, counts_.end());
             children_.pop_back();
+            counts_.pop_back();
             dest->children_.front()->SetParent(dest);
         }
 
-        return dest->keys_.front();
+        CompressPrefix();
+        dest->CompressPrefix();
+        UpdateHints_();
+        dest->UpdateHints_();
+
+        return dest->KeyAt(0);
     }
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::Update(const key_type& old_key, const key_type& new_key)
+template<class Key, class Tp, class Search, bool CompressKeys>
+bool BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Insert(key_type key, mapped_type value)
 {
-    auto index = GetKeyIndex(old_key);
+    auto index = GetKeyIndex(key);
 
-    if (Exists(old_key, index))
+    if (Exists(key, index))
     {
-        keys_.at(index) = new_key;
+        return false;
     }
 
-    assert(Exists(new_key, index));
-}
-
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::Update(const key_type& new_key)
-{
-    auto index = GetKeyIndex(new_key);
-
-    if (index == Size())
+    if constexpr (CompressKeys)
     {
-        --index;
+        if (auto length = CommonPrefixLength_(prefix_, key); length < prefix_.size())
+        {
+            ShortenPrefix_(length);
+            UpdateHints_();
+        }
+        StripPrefix_(key, prefix_.size());
     }
-    keys_.at(index) = new_key;
 
-    assert(Exists(new_key, index));
+    keys_.insert(keys_.begin() + index, std::move(key));
+    values_.insert(values_.begin() + index, std::move(value));
+    InsertHint_(index);
+
+    return true;
 }
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::BPlusTreeNode::Insert(key_type key, mapped_type value)
+template<class Key, class Tp, class Search, bool CompressKeys>
+bool BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Insert(const key_type& key, std::initializer_list<BPlusTreeNode*> children)
 {
     auto index = GetKeyIndex(key);
 
@@ -282,37 +363,57 @@ bool BPlusTree<Key, Tp>::BPlusTreeNode::Insert(key_type key, mapped_type value)
     }
 
     keys_.insert(keys_.begin() + index, key);
-    values_.insert(values_.begin() + index, value);
+    children_.insert(children_.begin() + index, children.begin(), children.end());
+    // The new children were split off the child that follows them, which has fewer entries now.
+    for (auto i = index; i < index + children.size(); ++i)
+    {
+        counts_.insert(counts_.begin() + i, children_[i]->Count());
+    }
+    if (auto next = index + children.size(); next < children_.size())
+    {
+        UpdateChildCount(next);
+    }
+    InsertHint_(index);
 
     return true;
 }
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::BPlusTreeNode::Insert(const key_type& key, const std::vector<BPlusTreeNode*>& children)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Append(key_type key, mapped_type value)
 {
-    auto index = GetKeyIndex(key);
-
-    if (Exists(key, index))
-    {
-        return false;
-    }
+    keys_.insert(keys_.end(), std::move(key));
+    values_.insert(values_.end(), std::move(value));
+    InsertHint_(keys_.size() - 1);
+}
 
-    keys_.insert(keys_.begin() + index, key);
-    children_.insert(children_.begin() + index, children.begin(), children.end());
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::AppendKey(key_type key)
+{
+    keys_.insert(keys_.end(), std::move(key));
+    InsertHint_(keys_.size() - 1);
+}
 
-    return true;
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::AppendChild(BPlusTreeNode* child)
+{
+    children_.insert(children_.end(), child);
+    counts_.insert(counts_.end(), child->Count());
+    child->SetParent(this);
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::InsertKeys(const std::vector<key_type>& keys)
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::key_type
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::ReplaceKey(size_type index, key_type key)
 {
-    auto index = GetKeyIndex(keys.front());
+    std::swap(keys_.at(index), key);
+    EraseHint_(index);
+    InsertHint_(index);
 
-    keys_.insert(keys_.begin() + index, keys.begin(), keys.end());
+    return key;
 }
 
-template<class Key, class Tp>
-bool BPlusTree<Key, Tp>::BPlusTreeNode::Erase(key_type key)
+template<class Key, class Tp, class Search, bool CompressKeys>
+bool BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Erase(key_view_type key)
 {
     auto index = GetKeyIndex(key);
 
@@ -329,35 +430,39 @@ bool BPlusTree<Key, Tp>::BPlusTreeNode::Erase(key_type key)
     else
     {
         children_.erase(children_.begin() + index);
+        counts_.erase(counts_.begin() + index);
     }
+    EraseHint_(index);
 
     return true;
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::Erase(const size_type& start, const size_type& end)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::Erase(const size_type& start, const size_type& end)
 {
     EraseKeys(start, end);
     EraseValues(start, end);
     EraseChildren(start, end);
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::EraseKeyByIndex(size_type index)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::EraseKeyByIndex(size_type index)
 {
     assert(index < keys_.size());
     assert(index >= 0);
     keys_.erase(keys_.begin() + index);
+    EraseHint_(index);
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::EraseKeys(const size_type& start, const size_type& end)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::EraseKeys(const size_type& start, const size_type& end)
 {
     keys_.erase(keys_.begin() + start, keys_.begin() + end);
+    UpdateHints_();
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::EraseValues(const size_type& start, const size_type& end)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::EraseValues(const size_type& start, const size_type& end)
 {
     if (IsLeaf())
     {
@@ -365,34 +470,213 @@ void BPlusTree<Key, Tp>::BPlusTreeNode::EraseValues(const size_type& start, cons
     }
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::EraseChildren(const size_type& start, const size_type& end)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::EraseChildren(const size_type& start, const size_type& end)
 {
     if (!IsLeaf())
     {
         children_.erase(children_.begin() + start, children_.begin() + end);
+        counts_.erase(counts_.begin() + start, counts_.begin() + end);
     }
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::EraseChild(const key_type& key)
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::EraseChildByIndex(size_type index)
 {
-    auto index = GetKeyIndex(key);
+    assert(index < children_.size());
+    assert(index >= 0);
+    children_.erase(children_.begin() + index);
+    counts_.erase(counts_.begin() + index);
+}
 
-    if (Exists(key, index))
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::ChangeChildCount(const BPlusTreeNode* child, bool increase) noexcept
+{
+    auto index = static_cast<size_type>(std::distance(children_.begin(), std::find(children_.begin(), children_.end(), child)));
+
+    if (increase)
     {
-        ++index;
+        ++counts_[index];
     }
+    else
+    {
+        --counts_[index];
+    }
+}
 
-    children_.erase(children_.begin() + index);
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::UpdateChildCount(size_type index) noexcept
+{
+    counts_[index] = children_[index]->Count();
 }
 
-template<class Key, class Tp>
-void BPlusTree<Key, Tp>::BPlusTreeNode::EraseChildByIndex(size_type index)
+// Grows the prefix of a leaf to everything its first and last keys have in common.
+// Bulk loaded and freshly split leaves are compressed this way; inserts only ever
+// shorten the prefix.
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::CompressPrefix()
 {
-    assert(index < children_.size());
-    assert(index >= 0);
-    children_.erase(children_.begin() + index);
+    if constexpr (CompressKeys)
+    {
+        if (!IsLeaf() || keys_.empty())
+        {
+            return;
+        }
+
+        if (auto length = CommonPrefixLength_(keys_.front(), keys_.back()); length != 0)
+        {
+            prefix_.append(keys_.front(), 0, length);
+            for (auto& key : keys_)
+            {
+                StripPrefix_(key, length);
+            }
+            UpdateHints_();
+        }
+    }
+}
+
+// Before cells move between two leaves, both are brought to the same prefix so
+// that the stored keys can be moved as they are.
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::ShareCommonPrefix_(BPlusTreeNode* other)
+{
+    if constexpr (CompressKeys)
+    {
+        if (!IsLeaf())
+        {
+            return;
+        }
+
+        if (other->keys_.empty())
+        {
+            other->prefix_ = prefix_;
+        }
+        else if (keys_.empty())
+        {
+            prefix_ = other->prefix_;
+        }
+        else
+        {
+            auto length = CommonPrefixLength_(prefix_, other->prefix_);
+            ShortenPrefix_(length);
+            other->ShortenPrefix_(length);
+        }
+    }
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::ShortenPrefix_(size_type length)
+{
+    if constexpr (CompressKeys)
+    {
+        if (length < prefix_.size())
+        {
+            for (auto& key : keys_)
+            {
+                key.insert(0, prefix_, length);
+            }
+            prefix_.resize(length);
+        }
+    }
+}
+
+// The rest of the key is reallocated, so that a short one moves into the string's
+// inline buffer and its heap block is released.
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::StripPrefix_(key_type& key, size_type length)
+{
+    if (length != 0)
+    {
+        key.erase(0, length);
+        key.shrink_to_fit();
+    }
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::size_type
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::CommonPrefixLength_(key_view_type lhs, key_view_type rhs) noexcept
+{
+    return std::mismatch(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()).first - lhs.begin();
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::InsertHint_(size_type index)
+{
+    if constexpr (Search::kUsesHints)
+    {
+        hints_.insert(hints_.begin() + index, Search::MakeHint(keys_[index]));
+    }
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::EraseHint_(size_type index)
+{
+    if constexpr (Search::kUsesHints)
+    {
+        hints_.erase(hints_.begin() + index);
+    }
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+void BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::UpdateHints_()
+{
+    if constexpr (Search::kUsesHints)
+    {
+        hints_.clear();
+        for (const auto& key : keys_)
+        {
+            hints_.insert(hints_.end(), Search::MakeHint(key));
+        }
+    }
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+template<class T>
+T* BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::StorageAt_(size_type offset) noexcept
+{
+    return reinterpret_cast<T*>(reinterpret_cast<std::byte*>(this) + offset);
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::size_type BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::HintsOffset_() noexcept
+{
+    return AlignUp_(sizeof(BPlusTreeNode), alignof(hint_type));
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::size_type
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::KeysOffset_(size_type order) noexcept
+{
+    auto hints_size = Search::kUsesHints ? order * sizeof(hint_type) : 0;
+    return AlignUp_(HintsOffset_() + hints_size, alignof(key_type));
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::size_type
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::TailOffset_(bool leaf, size_type order) noexcept
+{
+    return AlignUp_(KeysOffset_(order) + order * sizeof(key_type), leaf ? alignof(mapped_type) : alignof(BPlusTreeNode*));
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::size_type
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::CountsOffset_(size_type order) noexcept
+{
+    return AlignUp_(TailOffset_(false, order) + (order + 1) * sizeof(BPlusTreeNode*), alignof(size_type));
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::size_type
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::AllocationSize(bool leaf, size_type order) noexcept
+{
+    return leaf ? TailOffset_(leaf, order) + order * sizeof(mapped_type) : CountsOffset_(order) + (order + 1) * sizeof(size_type);
+}
+
+template<class Key, class Tp, class Search, bool CompressKeys>
+typename BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::size_type
+BPlusTree<Key, Tp, Search, CompressKeys>::BPlusTreeNode::AlignUp_(size_type offset, size_type alignment) noexcept
+{
+    return (offset + alignment - 1) / alignment * alignment;
 }
 
 } // namespace s21
@@ -0,0 +1,110 @@
+#ifndef TRANSACTIONS_INCLUDE_BPT_BUFFER_POOL_H_
+#define TRANSACTIONS_INCLUDE_BPT_BUFFER_POOL_H_
+
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+
+#include "common/page_file.h"
+
+namespace s21
+{
+
+/*
+Keeps at most capacity pages of a PageFile in memory, each decoded into a Page
+object. A Handle pins its page; pinned pages are never evicted, so the Page a
+handle points to stays put until the handle goes away. When a page that is not
+in memory is needed, the clock algorithm picks an unpinned page to evict: the
+hand skips and clears pages that were used since it last passed them, and takes
+the first one that was not. Pages marked dirty are encoded and written back when
+they are evicted or flushed.
+
+A Page is default constructible and has
+    void Encode(char* data, size_type size) const;
+    void Decode(const char* data, size_type size);
+where Decode replaces the whole content of the Page.
+
+The pool is not thread-safe.
+*/
+template<class Page>
+class BufferPool
+{
+public:
+    using size_type = std::size_t;
+    using page_id_type = PageFile::page_id_type;
+
+    class Handle
+    {
+    public:
+        Handle() = default;
+        ~Handle();
+
+        Handle(Handle&& other) noexcept;
+        Handle& operator=(Handle&& other) noexcept;
+        Handle(const Handle&) = delete;
+        Handle& operator=(const Handle&) = delete;
+
+        [[nodiscard]] Page& operator*() const noexcept;
+        [[nodiscard]] Page* operator->() const noexcept;
+        [[nodiscard]] page_id_type Id() const noexcept;
+        [[nodiscard]] explicit operator bool() const noexcept;
+        void MarkDirty() noexcept;
+        void Reset() noexcept;
+
+    private:
+        friend class BufferPool;
+        Handle(BufferPool* pool, size_type frame) noexcept;
+
+    private:
+        BufferPool* pool_{ nullptr };
+        size_type frame_{ 0 };
+    };
+
+public:
+    BufferPool(PageFile& file, size_type capacity);
+    ~BufferPool();
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    Handle Fetch(page_id_type id);
+    // Allocates a page in the file and returns it as a default constructed Page.
+    Handle Create();
+    // Gives the page back to the file. The handle must be the only one pinning it.
+    void Free(Handle handle);
+    void FlushAll();
+
+    [[nodiscard]] size_type Capacity() const noexcept;
+    [[nodiscard]] size_type NumHits() const noexcept;
+    [[nodiscard]] size_type NumMisses() const noexcept;
+
+private:
+    struct Frame
+    {
+        page_id_type id{ PageFile::kNoPage };
+        size_type pins{ 0 };
+        bool dirty{ false };
+        bool referenced{ false };
+        Page page{};
+    };
+
+    size_type TakeFrame_();
+    void WriteBack_(Frame& frame);
+    Handle Pin_(size_type index, page_id_type id);
+
+private:
+    PageFile& file_;
+    std::vector<Frame> frames_;
+    std::vector<size_type> free_frames_;
+    std::unordered_map<page_id_type, size_type> page_table_;
+    std::vector<char> buffer_;
+    size_type hand_{ 0 };
+    size_type num_hits_{ 0 };
+    size_type num_misses_{ 0 };
+};
+
+} // namespace s21
+
+#include "buffer_pool.tpp"
+
+#endif // TRANSACTIONS_INCLUDE_BPT_BUFFER_POOL_H_
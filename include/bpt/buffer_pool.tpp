@@ -0,0 +1,276 @@
+#ifndef TRANSACTIONS_INCLUDE_BPT_BUFFER_POOL_TPP_
+#define TRANSACTIONS_INCLUDE_BPT_BUFFER_POOL_TPP_
+
+#include <stdexcept>
+#include <utility>
+
+namespace s21
+{
+
+template<class Page>
+BufferPool<Page>::Handle::Handle(BufferPool* pool, size_type frame) noexcept
+    : pool_(pool)
+    , frame_(frame)
+{}
+
+template<class Page>
+BufferPool<Page>::Handle::~Handle()
+{
+    Reset();
+}
+
+template<class Page>
+BufferPool<Page>::Handle::Handle(Handle&& other) noexcept
+    : pool_(std::exchange(other.pool_, nullptr))
+    , frame_(other.frame_)
+{}
+
+template<class Page>
+typename BufferPool<Page>::Handle& BufferPool<Page>::Handle::operator=(Handle&& other) noexcept
+{
+    if (this != &other)
+    {
+        Reset();
+        pool_ = std::exchange(other.pool_, nullptr);
+        frame_ = other.frame_;
+    }
+
+    return *this;
+}
+
+template<class Page>
+Page& BufferPool<Page>::Handle::operator*() const noexcept
+{
+    return pool_->frames_[frame_].page;
+}
+
+template<class Page>
+Page* BufferPool<Page>::Handle::operator->() const noexcept
+{
+    return &pool_->frames_[frame_].page;
+}
+
+template<class Page>
+typename BufferPool<Page>::page_id_type BufferPool<Page>::Handle::Id() const noexcept
+{
+    return pool_->frames_[frame_].id;
+}
+
+template<class Page>
+BufferPool<Page>::Handle::operator bool() const noexcept
+{
+    return pool_ != nullptr;
+}
+
+template<class Page>
+void BufferPool<Page>::Handle::MarkDirty() noexcept
+{
+    pool_->frames_[frame_].dirty = true;
+}
+
+template<class Page>
+void BufferPool<Page>::Handle::Reset() noexcept
+{
+    if (pool_ != nullptr)
+    {
+        --pool_->frames_[frame_].pins;
+        pool_ = nullptr;
+    }
+}
+
+template<class Page>
+BufferPool<Page>::BufferPool(PageFile& file, size_type capacity)
+    : file_(file)
+    , frames_(capacity)
+    , buffer_(file.PageSize())
+{
+    if (capacity == 0)
+    {
+        throw std::invalid_argument("The buffer pool cannot be empty.");
+    }
+
+    page_table_.reserve(capacity);
+    for (size_type i = capacity; i > 0; --i)
+    {
+        free_frames_.push_back(i - 1);
+    }
+}
+
+template<class Page>
+BufferPool<Page>::~BufferPool()
+{
+    try
+    {
+        FlushAll();
+    }
+    catch (const std::exception&)
+    {
+    }
+}
+
+template<class Page>
+typename BufferPool<Page>::Handle BufferPool<Page>::Fetch(page_id_type id)
+{
+    if (auto it = page_table_.find(id); it != page_table_.end())
+    {
+        ++num_hits_;
+        return Pin_(it->second, id);
+    }
+
+    ++num_misses_;
+    auto index = TakeFrame_();
+
+    try
+    {
+        file_.Read(id, buffer_.data());
+        frames_[index].page.Decode(buffer_.data(), buffer_.size());
+    }
+    catch (...)
+    {
+        free_frames_.push_back(index);
+        throw;
+    }
+    frames_[index].dirty = false;
+
+    return Pin_(index, id);
+}
+
+template<class Page>
+typename BufferPool<Page>::Handle BufferPool<Page>::Create()
+{
+    auto index = TakeFrame_();
+    page_id_type id = PageFile::kNoPage;
+
+    try
+    {
+        id = file_.Allocate();
+    }
+    catch (...)
+    {
+        free_frames_.push_back(index);
+        throw;
+    }
+    frames_[index].page = Page{};
+    frames_[index].dirty = true;
+
+    return Pin_(index, id);
+}
+
+template<class Page>
+void BufferPool<Page>::Free(Handle handle)
+{
+    auto index = handle.frame_;
+    auto& frame = frames_[index];
+    auto id = frame.id;
+
+    if (frame.pins != 1)
+    {
+        throw std::logic_error("A page that is still in use cannot be freed.");
+    }
+
+    handle.Reset();
+    page_table_.erase(id);
+    frame.id = PageFile::kNoPage;
+    frame.dirty = false;
+    free_frames_.push_back(index);
+    file_.Free(id);
+}
+
+template<class Page>
+void BufferPool<Page>::FlushAll()
+{
+    for (auto& frame : frames_)
+    {
+        if (frame.id != PageFile::kNoPage && frame.dirty)
+        {
+            WriteBack_(frame);
+        }
+    }
+}
+
+template<class Page>
+typename BufferPool<Page>::size_type BufferPool<Page>::Capacity() const noexcept
+{
+    return frames_.size();
+}
+
+template<class Page>
+typename BufferPool<Page>::size_type BufferPool<Page>::NumHits() const noexcept
+{
+    return num_hits_;
+}
+
+template<class Page>
+typename BufferPool<Page>::size_type BufferPool<Page>::NumMisses() const noexcept
+{
+    return num_misses_;
+}
+
+// Returns an empty frame, evicting a page if there is none. Two turns of the
+// hand are enough to find an unpinned page, if there is one.
+template<class Page>
+typename BufferPool<Page>::size_type BufferPool<Page>::TakeFrame_()
+{
+    if (!free_frames_.empty())
+    {
+        auto index = free_frames_.back();
+        free_frames_.pop_back();
+        return index;
+    }
+
+    for (size_type step = 0; step < 2 * frames_.size(); ++step)
+    {
+        auto index = hand_;
+        auto& frame = frames_[index];
+
+        hand_ = (hand_ + 1) % frames_.size();
+        if (frame.pins != 0)
+        {
+            continue;
+        }
+        if (frame.referenced)
+        {
+            frame.referenced = false;
+            continue;
+        }
+
+        if (frame.dirty)
+        {
+            WriteBack_(frame);
+        }
+        page_table_.erase(frame.id);
+        frame.id = PageFile::kNoPage;
+
+        return index;
+    }
+
+    throw std::runtime_error("All pages of the buffer pool are in use.");
+}
+
+template<class Page>
+void BufferPool<Page>::WriteBack_(Frame& frame)
+{
+    frame.page.Encode(buffer_.data(), buffer_.size());
+    file_.Write(frame.id, buffer_.data());
+    frame.dirty = false;
+}
+
+template<class Page>
+typename BufferPool<Page>::Handle BufferPool<Page>::Pin_(size_type index, page_id_type id)
+{
+    auto& frame = frames_[index];
+
+    if (frame.id != id)
+    {
+        frame.id = id;
+        page_table_.emplace(id, index);
+    }
+    frame.referenced = true;
+    ++frame.pins;
+
+    return Handle(this, index);
+}
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_BPT_BUFFER_POOL_TPP_
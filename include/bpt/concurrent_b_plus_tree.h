@@ -0,0 +1,144 @@
+#ifndef TRANSACTIONS_INCLUDE_BPT_CONCURRENT_B_PLUS_TREE_H_
+#define TRANSACTIONS_INCLUDE_BPT_CONCURRENT_B_PLUS_TREE_H_
+
+#include <vector>
+#include <atomic>
+#include <optional>
+#include <new>
+#include <cstddef>
+
+#include "common/ordered_storage_interface.h"
+#include "common/optimistic_latch.h"
+#include "common/epoch_manager.h"
+
+namespace s21
+{
+
+/*
+B+ tree that can be used from many threads at once, with optimistic lock
+coupling. Every node has an OptimisticLatch. Readers walk down the tree without
+writing to shared memory: they check the version of each node after reading it
+and start over from the root if a writer got in between. Writers descend the
+same way and lock only the nodes they change: the leaf they insert into or erase
+from, and a node with its parent when the node is split or merged. Full nodes
+are split on the way down, so that a split never has to go up more than one
+level. Locks are only ever tried, never waited for, so writers cannot deadlock.
+
+Nodes keep pointers to immutable records and separator keys. Whatever a writer
+unlinks is handed to the EpochManager and freed once no reader can still hold
+it. Leaves that become small are merged with a sibling under the same parent;
+internal nodes are never merged, so the tree does not get lower.
+
+Records never move, so a reference returned by GetValue stays valid until the
+key is erased. Writing through it is not synchronised with readers.
+
+Scans copy one leaf at a time and continue from the separator that bounds it, so
+they see every key that is not changed during the scan.
+*/
+template<class Key, class Tp = Value>
+class ConcurrentBPlusTree : public OrderedKeyValueStorageInterface<Key, Tp>
+{
+public:
+    using key_type = typename OrderedKeyValueStorageInterface<Key, Tp>::key_type;
+    using mapped_type = typename OrderedKeyValueStorageInterface<Key, Tp>::mapped_type;
+    using size_type = typename OrderedKeyValueStorageInterface<Key, Tp>::size_type;
+    using key_view_type = typename OrderedKeyValueStorageInterface<Key, Tp>::key_view_type;
+    using ScanCursor = typename OrderedKeyValueStorageInterface<Key, Tp>::ScanCursor;
+    using ScanResult = typename OrderedKeyValueStorageInterface<Key, Tp>::ScanResult;
+
+private:
+    using version_type = OptimisticLatch::version_type;
+
+    struct Record final
+    {
+        key_type key{};
+        mapped_type value{};
+    };
+
+    struct Node
+    {
+        OptimisticLatch latch;
+        bool leaf{ false };
+        std::atomic<size_type> size{ 0 };
+    };
+
+    // The arrays follow the node in the same allocation.
+    struct LeafNode final : Node
+    {
+        std::atomic<Record*>* records{ nullptr };
+
+        static LeafNode* Create(size_type capacity);
+        static void Destroy(void* node) noexcept;
+    };
+
+    struct InnerNode final : Node
+    {
+        std::atomic<const key_type*>* keys{ nullptr };
+        std::atomic<Node*>* children{ nullptr };
+
+        static InnerNode* Create(size_type capacity);
+        static void Destroy(void* node) noexcept;
+    };
+
+    enum class Status
+    {
+        kDone,
+        kNotDone,
+        kRestart
+    };
+
+    struct LeafCopy
+    {
+        std::vector<std::pair<key_type, mapped_type>> entries;
+        std::optional<key_type> upper;
+    };
+
+public:
+    static constexpr size_type kDefaultOrder{ 32 };
+
+public:
+    ConcurrentBPlusTree();
+    explicit ConcurrentBPlusTree(size_type order);
+    ~ConcurrentBPlusTree() override;
+
+    ConcurrentBPlusTree(const ConcurrentBPlusTree&) = delete;
+    ConcurrentBPlusTree& operator=(const ConcurrentBPlusTree&) = delete;
+
+    bool Insert(key_type key, mapped_type value) override;
+    mapped_type& GetValue(key_view_type key) override;
+    bool Exists(key_view_type key) override;
+    bool Erase(key_view_type key) override;
+    std::vector<std::pair<key_type, mapped_type>> ShowAll() override;
+    ScanResult Scan(const ScanCursor& cursor, size_type count) override;
+    std::vector<std::pair<key_type, mapped_type>> RangeScan(key_view_type lower, key_view_type upper, size_type limit) override;
+    std::vector<std::pair<key_type, mapped_type>> PrefixScan(key_view_type prefix, size_type limit) override;
+    [[nodiscard]] size_type Size() const override;
+
+private:
+    Record* Find_(key_view_type key);
+    // Moves key and value into a new record only if it inserts them.
+    Status TryInsert_(key_type& key, mapped_type& value);
+    Status TryErase_(key_view_type key);
+    void TryMerge_(LeafNode* leaf, InnerNode* parent, version_type parent_version);
+    void Split_(Node* node, InnerNode* parent);
+    void InsertSeparator_(InnerNode* parent, const key_type* separator, Node* right_node);
+    bool ReadLeaf_(const std::optional<key_type>& lower, LeafCopy& copy);
+    template<class Visitor>
+    void ForEachFrom_(std::optional<key_type> lower, bool exclusive, Visitor visitor);
+    [[nodiscard]] size_type ChildIndex_(const InnerNode* node, key_view_type key) const noexcept;
+    [[nodiscard]] size_type RecordIndex_(const LeafNode* node, key_view_type key) const noexcept;
+    [[nodiscard]] size_type LoadSize_(const Node* node) const noexcept;
+    void Clear_(Node* node);
+
+private:
+    std::atomic<Node*> root_;
+    size_type order_;
+    std::atomic<size_type> num_elements_{ 0 };
+    EpochManager epoch_manager_;
+};
+
+} // namespace s21
+
+#include "concurrent_b_plus_tree.tpp"
+
+#endif // TRANSACTIONS_INCLUDE_BPT_CONCURRENT_B_PLUS_TREE_H_
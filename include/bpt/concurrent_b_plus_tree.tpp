@@ -0,0 +1,796 @@
+#ifndef TRANSACTIONS_INCLUDE_BPT_CONCURRENT_B_PLUS_TREE_TPP_
+#define TRANSACTIONS_INCLUDE_BPT_CONCURRENT_B_PLUS_TREE_TPP_
+
+#include <algorithm>
+#include <utility>
+
+namespace s21
+{
+
+template<class Key, class Tp>
+typename ConcurrentBPlusTree<Key, Tp>::LeafNode* ConcurrentBPlusTree<Key, Tp>::LeafNode::Create(size_type capacity)
+{
+    auto memory = ::operator new(sizeof(LeafNode) + capacity * sizeof(std::atomic<Record*>));
+    auto node = ::new (memory) LeafNode();
+
+    node->leaf = true;
+    node->records = reinterpret_cast<std::atomic<Record*>*>(node + 1);
+    for (size_type i = 0; i < capacity; ++i)
+    {
+        ::new (node->records + i) std::atomic<Record*>(nullptr);
+    }
+
+    return node;
+}
+
+template<class Key, class Tp>
+void ConcurrentBPlusTree<Key, Tp>::LeafNode::Destroy(void* node) noexcept
+{
+    static_cast<LeafNode*>(node)->~LeafNode();
+    ::operator delete(node);
+}
+
+template<class Key, class Tp>
+typename ConcurrentBPlusTree<Key, Tp>::InnerNode* ConcurrentBPlusTree<Key, Tp>::InnerNode::Create(size_type capacity)
+{
+    auto memory = ::operator new(sizeof(InnerNode) + capacity * sizeof(std::atomic<const key_type*>)
+                                 + (capacity + 1) * sizeof(std::atomic<Node*>));
+    auto node = ::new (memory) InnerNode();
+
+    node->keys = reinterpret_cast<std::atomic<const key_type*>*>(node + 1);
+    node->children = reinterpret_cast<std::atomic<Node*>*>(node->keys + capacity);
+    for (size_type i = 0; i < capacity; ++i)
+    {
+        ::new (node->keys + i) std::atomic<const key_type*>(nullptr);
+    }
+    for (size_type i = 0; i <= capacity; ++i)
+    {
+        ::new (node->children + i) std::atomic<Node*>(nullptr);
+    }
+
+    return node;
+}
+
+template<class Key, class Tp>
+void ConcurrentBPlusTree<Key, Tp>::InnerNode::Destroy(void* node) noexcept
+{
+    static_cast<InnerNode*>(node)->~InnerNode();
+    ::operator delete(node);
+}
+
+template<class Key, class Tp>
+ConcurrentBPlusTree<Key, Tp>::ConcurrentBPlusTree()
+    : ConcurrentBPlusTree(kDefaultOrder)
+{}
+
+// A node holds at most order keys: it is split on the way down once it has that many.
+template<class Key, class Tp>
+ConcurrentBPlusTree<Key, Tp>::ConcurrentBPlusTree(size_type order)
+    : root_(nullptr)
+    , order_(order)
+{
+    if (order_ <= 2)
+    {
+        throw std::invalid_argument("The order of the tree cannot be less than or equal to 2.");
+    }
+    root_.store(LeafNode::Create(order_));
+}
+
+template<class Key, class Tp>
+ConcurrentBPlusTree<Key, Tp>::~ConcurrentBPlusTree()
+{
+    Clear_(root_.load());
+}
+
+template<class Key, class Tp>
+bool ConcurrentBPlusTree<Key, Tp>::Insert(key_type key, mapped_type value)
+{
+    auto guard = epoch_manager_.Pin();
+    auto status = Status::kRestart;
+
+    while (status == Status::kRestart)
+    {
+        status = TryInsert_(key, value);
+    }
+
+    if (status == Status::kNotDone)
+    {
+        return false;
+    }
+
+    num_elements_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+template<class Key, class Tp>
+typename ConcurrentBPlusTree<Key, Tp>::mapped_type& ConcurrentBPlusTree<Key, Tp>::GetValue(key_view_type key)
+{
+    auto guard = epoch_manager_.Pin();
+
+    if (auto record = Find_(key); record)
+    {
+        return record->value;
+    }
+
+    throw std::runtime_error("The value was not found.");
+}
+
+template<class Key, class Tp>
+bool ConcurrentBPlusTree<Key, Tp>::Exists(key_view_type key)
+{
+    auto guard = epoch_manager_.Pin();
+
+    return Find_(key) != nullptr;
+}
+
+template<class Key, class Tp>
+bool ConcurrentBPlusTree<Key, Tp>::Erase(key_view_type key)
+{
+    auto guard = epoch_manager_.Pin();
+    auto status = Status::kRestart;
+
+    while (status == Status::kRestart)
+    {
+        status = TryErase_(key);
+    }
+
+    if (status == Status::kNotDone)
+    {
+        return false;
+    }
+
+    num_elements_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+template<class Key, class Tp>
+std::vector<std::pair<typename ConcurrentBPlusTree<Key, Tp>::key_type, typename ConcurrentBPlusTree<Key, Tp>::mapped_type>>
+ConcurrentBPlusTree<Key, Tp>::ShowAll()
+{
+    std::vector<std::pair<key_type, mapped_type>> entries;
+
+    ForEachFrom_(std::nullopt, false, [&entries](std::pair<key_type, mapped_type>&& entry)
+    {
+        entries.push_back(std::move(entry));
+        return true;
+    });
+
+    return entries;
+}
+
+template<class Key, class Tp>
+typename ConcurrentBPlusTree<Key, Tp>::ScanResult ConcurrentBPlusTree<Key, Tp>::Scan(const ScanCursor& cursor, size_type count)
+{
+    ScanResult result;
+
+    result.cursor.finished = true;
+    if (cursor.finished)
+    {
+        return result;
+    }
+
+    ForEachFrom_(cursor.last_key, cursor.last_key.has_value(), [&result, count](std::pair<key_type, mapped_type>&& entry)
+    {
+        if (result.entries.size() == count)
+        {
+            result.cursor.finished = false;
+            return false;
+        }
+
+        result.entries.push_back(std::move(entry));
+        return true;
+    });
+
+    result.cursor.last_key = result.entries.empty() ? cursor.last_key : result.entries.back().first;
+
+    return result;
+}
+
+template<class Key, class Tp>
+std::vector<std::pair<typename ConcurrentBPlusTree<Key, Tp>::key_type, typename ConcurrentBPlusTree<Key, Tp>::mapped_type>>
+ConcurrentBPlusTree<Key, Tp>::RangeScan(key_view_type lower, key_view_type upper, size_type limit)
+{
+    std::vector<std::pair<key_type, mapped_type>> entries;
+
+    ForEachFrom_(key_type(lower), false, [&entries, &upper, limit](std::pair<key_type, mapped_type>&& entry)
+    {
+        if ((limit != 0 && entries.size() == limit) || upper < entry.first)
+        {
+            return false;
+        }
+
+        entries.push_back(std::move(entry));
+        return true;
+    });
+
+    return entries;
+}
+
+template<class Key, class Tp>
+std::vector<std::pair<typename ConcurrentBPlusTree<Key, Tp>::key_type, typename ConcurrentBPlusTree<Key, Tp>::mapped_type>>
+ConcurrentBPlusTree<Key, Tp>::PrefixScan(key_view_type prefix, size_type limit)
+{
+    std::vector<std::pair<key_type, mapped_type>> entries;
+
+    ForEachFrom_(key_type(prefix), false, [&entries, &prefix, limit](std::pair<key_type, mapped_type>&& entry)
+    {
+        if ((limit != 0 && entries.size() == limit) || !OrderedKeyValueStorageInterface<Key, Tp>::HasPrefix(entry.first, prefix))
+        {
+            return false;
+        }
+
+        entries.push_back(std::move(entry));
+        return true;
+    });
+
+    return entries;
+}
+
+template<class Key, class Tp>
+typename ConcurrentBPlusTree<Key, Tp>::size_type ConcurrentBPlusTree<Key, Tp>::Size() const
+{
+    return num_elements_.load(std::memory_order_relaxed);
+}
+
+// The caller has pinned an epoch, which keeps the returned record alive.
+template<class Key, class Tp>
+typename ConcurrentBPlusTree<Key, Tp>::Record* ConcurrentBPlusTree<Key, Tp>::Find_(key_view_type key)
+{
+    for (;;)
+    {
+        auto node = root_.load(std::memory_order_acquire);
+        version_type version;
+
+        if (!node->latch.ReadLock(version) || node != root_.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        bool restart = false;
+        while (!node->leaf && !restart)
+        {
+            auto inner = static_cast<InnerNode*>(node);
+            auto child = inner->children[ChildIndex_(inner, key)].load(std::memory_order_acquire);
+            version_type child_version = 0;
+
+            // The child is read locked before its parent is validated, so that a split
+            // of the child in between cannot send the search to the wrong node.
+            restart = child == nullptr || !child->latch.ReadLock(child_version) || !inner->latch.Validate(version);
+            node = child;
+            version = child_version;
+        }
+        if (restart)
+        {
+            continue;
+        }
+
+        auto leaf = static_cast<LeafNode*>(node);
+        auto index = RecordIndex_(leaf, key);
+        auto record = index < LoadSize_(leaf) ? leaf->records[index].load(std::memory_order_acquire) : nullptr;
+        auto found = record != nullptr && record->key == key;
+
+        if (leaf->latch.Validate(version))
+        {
+            return found ? record : nullptr;
+        }
+    }
+}
+
+template<class Key, class Tp>
+typename ConcurrentBPlusTree<Key, Tp>::Status ConcurrentBPlusTree<Key, Tp>::TryInsert_(key_type& key, mapped_type& value)
+{
+    auto node = root_.load(std::memory_order_acquire);
+    version_type version;
+    InnerNode* parent = nullptr;
+    version_type parent_version = 0;
+
+    if (!node->latch.ReadLock(version) || node != root_.load(std::memory_order_acquire))
+    {
+        return Status::kRestart;
+    }
+
+    for (;;)
+    {
+        // A full node is split on the way down, so its parent always has room for
+        // the new separator. The locks fail if either node changed since it was read.
+        if (LoadSize_(node) == order_)
+        {
+            if (parent != nullptr && !parent->latch.Upgrade(parent_version))
+            {
+                return Status::kRestart;
+            }
+            if (!node->latch.Upgrade(version))
+            {
+                if (parent != nullptr)
+                {
+                    parent->latch.Unlock();
+                }
+                return Status::kRestart;
+            }
+            if (parent == nullptr && node != root_.load(std::memory_order_acquire))
+            {
+                node->latch.Unlock();
+                return Status::kRestart;
+            }
+
+            Split_(node, parent);
+            node->latch.Unlock();
+            if (parent != nullptr)
+            {
+                parent->latch.Unlock();
+            }
+            return Status::kRestart;
+        }
+
+        if (node->leaf)
+        {
+            break;
+        }
+
+        auto inner = static_cast<InnerNode*>(node);
+        auto child = inner->children[ChildIndex_(inner, key)].load(std::memory_order_acquire);
+        version_type child_version = 0;
+
+        if ((parent != nullptr && !parent->latch.Validate(parent_version))
+            || child == nullptr || !child->latch.ReadLock(child_version) || !inner->latch.Validate(version))
+        {
+            return Status::kRestart;
+        }
+
+        parent = inner;
+        parent_version = version;
+        node = child;
+        version = child_version;
+    }
+
+    auto leaf = static_cast<LeafNode*>(node);
+
+    if (!leaf->latch.Upgrade(version))
+    {
+        return Status::kRestart;
+    }
+
+    auto size = LoadSize_(leaf);
+    auto index = RecordIndex_(leaf, key);
+
+    if (index < size && leaf->records[index].load(std::memory_order_acquire)->key == key)
+    {
+        leaf->latch.Unlock();
+        return Status::kNotDone;
+    }
+
+    // The record is only made once the key is known to be missing.
+    Record* record = nullptr;
+    try
+    {
+        record = new Record{ std::move(key), std::move(value) };
+    }
+    catch (...)
+    {
+        leaf->latch.Unlock();
+        throw;
+    }
+
+    for (auto i = size; i > index; --i)
+    {
+        leaf->records[i].store(leaf->records[i - 1].load(std::memory_order_acquire), std::memory_order_release);
+    }
+    leaf->records[index].store(record, std::memory_order_release);
+    leaf->size.store(size + 1, std::memory_order_relaxed);
+    leaf->latch.Unlock();
+
+    return Status::kDone;
+}
+
+template<class Key, class Tp>
+typename ConcurrentBPlusTree<Key, Tp>::Status ConcurrentBPlusTree<Key, Tp>::TryErase_(key_view_type key)
+{
+    auto node = root_.load(std::memory_order_acquire);
+    version_type version;
+    InnerNode* parent = nullptr;
+    version_type parent_version = 0;
+
+    if (!node->latch.ReadLock(version) || node != root_.load(std::memory_order_acquire))
+    {
+        return Status::kRestart;
+    }
+
+    while (!node->leaf)
+    {
+        auto inner = static_cast<InnerNode*>(node);
+        auto child = inner->children[ChildIndex_(inner, key)].load(std::memory_order_acquire);
+        version_type child_version = 0;
+
+        if (child == nullptr || !child->latch.ReadLock(child_version) || !inner->latch.Validate(version))
+        {
+            return Status::kRestart;
+        }
+
+        parent = inner;
+        parent_version = version;
+        node = child;
+        version = child_version;
+    }
+
+    auto leaf = static_cast<LeafNode*>(node);
+
+    if (!leaf->latch.Upgrade(version))
+    {
+        return Status::kRestart;
+    }
+
+    auto size = LoadSize_(leaf);
+    auto index = RecordIndex_(leaf, key);
+    auto record = index < size ? leaf->records[index].load(std::memory_order_acquire) : nullptr;
+
+    if (record == nullptr || !(record->key == key))
+    {
+        leaf->latch.Unlock();
+        return Status::kNotDone;
+    }
+
+    for (auto i = index; i + 1 < size; ++i)
+    {
+        leaf->records[i].store(leaf->records[i + 1].load(std::memory_order_acquire), std::memory_order_release);
+    }
+    leaf->size.store(size - 1, std::memory_order_relaxed);
+
+    if (parent != nullptr && (size - 1) * 4 <= order_)
+    {
+        TryMerge_(leaf, parent, parent_version);
+    }
+    else
+    {
+        leaf->latch.Unlock();
+    }
+    epoch_manager_.Retire(record);
+
+    return Status::kDone;
+}
+
+// Merges the locked leaf with a sibling under the same parent if both fit in half
+// a node. The key is already erased, so the merge is skipped rather than retried
+// when the parent or the sibling is busy. Unlocks the leaf.
+template<class Key, class Tp>
+void ConcurrentBPlusTree<Key, Tp>::TryMerge_(LeafNode* leaf, InnerNode* parent, version_type parent_version)
+{
+    if (!parent->latch.Upgrade(parent_version))
+    {
+        leaf->latch.Unlock();
+        return;
+    }
+
+    auto parent_size = LoadSize_(parent);
+    size_type index = 0;
+
+    while (index < parent_size && parent->children[index].load(std::memory_order_acquire) != leaf)
+    {
+        ++index;
+    }
+
+    auto separator_index = (index == parent_size && index != 0) ? index - 1 : index;
+    auto left = static_cast<LeafNode*>(parent->children[separator_index].load(std::memory_order_acquire));
+    auto right = separator_index < parent_size ? static_cast<LeafNode*>(parent->children[separator_index + 1].load(std::memory_order_acquire)) : nullptr;
+    auto sibling = (left == leaf) ? right : left;
+
+    if (sibling == nullptr || !sibling->latch.TryLock())
+    {
+        leaf->latch.Unlock();
+        parent->latch.Unlock();
+        return;
+    }
+
+    auto left_size = LoadSize_(left);
+    auto right_size = LoadSize_(right);
+
+    if (left_size + right_size > order_ / 2)
+    {
+        sibling->latch.Unlock();
+        leaf->latch.Unlock();
+        parent->latch.Unlock();
+        return;
+    }
+
+    auto separator = parent->keys[separator_index].load(std::memory_order_acquire);
+
+    for (size_type i = 0; i < right_size; ++i)
+    {
+        left->records[left_size + i].store(right->records[i].load(std::memory_order_acquire), std::memory_order_release);
+    }
+    left->size.store(left_size + right_size, std::memory_order_relaxed);
+
+    for (auto i = separator_index; i + 1 < parent_size; ++i)
+    {
+        parent->keys[i].store(parent->keys[i + 1].load(std::memory_order_acquire), std::memory_order_release);
+        parent->children[i + 1].store(parent->children[i + 2].load(std::memory_order_acquire), std::memory_order_release);
+    }
+    parent->size.store(parent_size - 1, std::memory_order_relaxed);
+
+    right->latch.UnlockObsolete();
+    left->latch.Unlock();
+    parent->latch.Unlock();
+    epoch_manager_.Retire(const_cast<key_type*>(separator));
+    epoch_manager_.Retire(right, &LeafNode::Destroy);
+}
+
+// Splits the locked node in two halves and adds the right one to the locked parent,
+// or to a new root if there is no parent. The parent has room for it.
+template<class Key, class Tp>
+void ConcurrentBPlusTree<Key, Tp>::Split_(Node* node, InnerNode* parent)
+{
+    auto size = LoadSize_(node);
+    auto middle = size / 2;
+    const key_type* separator = nullptr;
+    Node* right_node = nullptr;
+
+    if (node->leaf)
+    {
+        auto leaf = static_cast<LeafNode*>(node);
+        auto right = LeafNode::Create(order_);
+
+        for (auto i = middle; i < size; ++i)
+        {
+            right->records[i - middle].store(leaf->records[i].load(std::memory_order_acquire), std::memory_order_release);
+        }
+        right->size.store(size - middle, std::memory_order_relaxed);
+        leaf->size.store(middle, std::memory_order_relaxed);
+        separator = new key_type(right->records[0].load(std::memory_order_acquire)->key);
+        right_node = right;
+    }
+    else
+    {
+        // The middle key moves up to the parent.
+        auto inner = static_cast<InnerNode*>(node);
+        auto right = InnerNode::Create(order_);
+
+        for (auto i = middle + 1; i < size; ++i)
+        {
+            right->keys[i - middle - 1].store(inner->keys[i].load(std::memory_order_acquire), std::memory_order_release);
+        }
+        for (auto i = middle + 1; i <= size; ++i)
+        {
+            right->children[i - middle - 1].store(inner->children[i].load(std::memory_order_acquire), std::memory_order_release);
+        }
+        right->size.store(size - middle - 1, std::memory_order_relaxed);
+        inner->size.store(middle, std::memory_order_relaxed);
+        separator = inner->keys[middle].load(std::memory_order_acquire);
+        right_node = right;
+    }
+
+    if (parent != nullptr)
+    {
+        InsertSeparator_(parent, separator, right_node);
+    }
+    else
+    {
+        auto root = InnerNode::Create(order_);
+
+        root->keys[0].store(separator, std::memory_order_release);
+        root->children[0].store(node, std::memory_order_release);
+        root->children[1].store(right_node, std::memory_order_release);
+        root->size.store(1, std::memory_order_relaxed);
+        root_.store(root, std::memory_order_release);
+    }
+}
+
+template<class Key, class Tp>
+void ConcurrentBPlusTree<Key, Tp>::InsertSeparator_(InnerNode* parent, const key_type* separator, Node* right_node)
+{
+    auto size = LoadSize_(parent);
+    auto index = ChildIndex_(parent, *separator);
+
+    for (auto i = size; i > index; --i)
+    {
+        parent->keys[i].store(parent->keys[i - 1].load(std::memory_order_acquire), std::memory_order_release);
+        parent->children[i + 1].store(parent->children[i].load(std::memory_order_acquire), std::memory_order_release);
+    }
+    parent->keys[index].store(separator, std::memory_order_release);
+    parent->children[index + 1].store(right_node, std::memory_order_release);
+    parent->size.store(size + 1, std::memory_order_relaxed);
+}
+
+// Copies the entries of the leaf that holds lower, starting at lower, together with
+// the separator that bounds the leaf from above. Returns false if a writer got in
+// between. The caller has pinned an epoch.
+template<class Key, class Tp>
+bool ConcurrentBPlusTree<Key, Tp>::ReadLeaf_(const std::optional<key_type>& lower, LeafCopy& copy)
+{
+    auto node = root_.load(std::memory_order_acquire);
+    version_type version;
+    const key_type* upper = nullptr;
+
+    copy.entries.clear();
+    copy.upper.reset();
+    if (!node->latch.ReadLock(version) || node != root_.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    while (!node->leaf)
+    {
+        auto inner = static_cast<InnerNode*>(node);
+        auto index = lower ? ChildIndex_(inner, *lower) : 0;
+        auto child = inner->children[index].load(std::memory_order_acquire);
+        version_type child_version = 0;
+
+        if (index < LoadSize_(inner))
+        {
+            upper = inner->keys[index].load(std::memory_order_acquire);
+        }
+        if (child == nullptr || !child->latch.ReadLock(child_version) || !inner->latch.Validate(version))
+        {
+            return false;
+        }
+
+        node = child;
+        version = child_version;
+    }
+
+    // A leaf that has just taken over its right sibling can hold keys past the
+    // separator read above. They are left for the next leaf read.
+    auto leaf = static_cast<LeafNode*>(node);
+    auto size = LoadSize_(leaf);
+
+    for (size_type i = 0; i < size; ++i)
+    {
+        auto record = leaf->records[i].load(std::memory_order_acquire);
+
+        if (record == nullptr)
+        {
+            return false;
+        }
+        if (lower && record->key < *lower)
+        {
+            continue;
+        }
+        if (upper != nullptr && !(record->key < *upper))
+        {
+            break;
+        }
+        copy.entries.emplace_back(record->key, record->value);
+    }
+
+    if (!leaf->latch.Validate(version))
+    {
+        return false;
+    }
+    if (upper != nullptr)
+    {
+        copy.upper = *upper;
+    }
+
+    return true;
+}
+
+// Calls visitor with the entries from lower on, in key order, until it returns false.
+template<class Key, class Tp>
+template<class Visitor>
+void ConcurrentBPlusTree<Key, Tp>::ForEachFrom_(std::optional<key_type> lower, bool exclusive, Visitor visitor)
+{
+    LeafCopy copy;
+
+    for (;;)
+    {
+        {
+            auto guard = epoch_manager_.Pin();
+            while (!ReadLeaf_(lower, copy))
+            {
+            }
+        }
+
+        for (auto& entry : copy.entries)
+        {
+            if (exclusive && !(*lower < entry.first))
+            {
+                continue;
+            }
+            if (!visitor(std::move(entry)))
+            {
+                return;
+            }
+        }
+
+        if (!copy.upper)
+        {
+            return;
+        }
+        lower = std::move(copy.upper);
+        exclusive = false;
+    }
+}
+
+// The number of separators not greater than key, which is the index of the child
+// whose keys are in [keys[index - 1], keys[index]).
+template<class Key, class Tp>
+typename ConcurrentBPlusTree<Key, Tp>::size_type
+ConcurrentBPlusTree<Key, Tp>::ChildIndex_(const InnerNode* node, key_view_type key) const noexcept
+{
+    size_type first = 0;
+    auto count = LoadSize_(node);
+
+    while (count > 0)
+    {
+        auto half = count / 2;
+        auto separator = node->keys[first + half].load(std::memory_order_acquire);
+
+        if (separator != nullptr && !(key < *separator))
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+
+    return first;
+}
+
+template<class Key, class Tp>
+typename ConcurrentBPlusTree<Key, Tp>::size_type
+ConcurrentBPlusTree<Key, Tp>::RecordIndex_(const LeafNode* node, key_view_type key) const noexcept
+{
+    size_type first = 0;
+    auto count = LoadSize_(node);
+
+    while (count > 0)
+    {
+        auto half = count / 2;
+        auto record = node->records[first + half].load(std::memory_order_acquire);
+
+        if (record != nullptr && record->key < key)
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+
+    return first;
+}
+
+// A reader can see a size that a writer is changing, but never one past the arrays.
+template<class Key, class Tp>
+typename ConcurrentBPlusTree<Key, Tp>::size_type ConcurrentBPlusTree<Key, Tp>::LoadSize_(const Node* node) const noexcept
+{
+    return std::min(node->size.load(std::memory_order_relaxed), order_);
+}
+
+template<class Key, class Tp>
+void ConcurrentBPlusTree<Key, Tp>::Clear_(Node* node)
+{
+    auto size = LoadSize_(node);
+
+    if (node->leaf)
+    {
+        auto leaf = static_cast<LeafNode*>(node);
+
+        for (size_type i = 0; i < size; ++i)
+        {
+            delete leaf->records[i].load();
+        }
+        LeafNode::Destroy(leaf);
+    }
+    else
+    {
+        auto inner = static_cast<InnerNode*>(node);
+
+        for (size_type i = 0; i <= size; ++i)
+        {
+            Clear_(inner->children[i].load());
+        }
+        for (size_type i = 0; i < size; ++i)
+        {
+            delete inner->keys[i].load();
+        }
+        InnerNode::Destroy(inner);
+    }
+}
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_BPT_CONCURRENT_B_PLUS_TREE_TPP_
@@ -0,0 +1,75 @@
+#ifndef TRANSACTIONS_INCLUDE_BPT_INLINE_ARRAY_H_
+#define TRANSACTIONS_INCLUDE_BPT_INLINE_ARRAY_H_
+
+#include <cstddef>
+#include <iterator>
+
+namespace s21
+{
+
+/*
+Fixed capacity array over storage owned by someone else, used by B+ tree nodes
+to keep their keys, values and children in the same allocation as the node.
+The array owns its elements but not the memory they live in. Elements are
+shifted by move construction rather than assignment, because Value assignment
+merges fields instead of replacing them, and moves must not throw.
+
+Inserting past the capacity throws std::length_error. If a copy throws while a
+range is inserted, the array is left as it was.
+*/
+template<class T>
+class InlineArray
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+public:
+    InlineArray() = default;
+    InlineArray(T* data, size_type capacity) noexcept;
+    ~InlineArray();
+
+    InlineArray(const InlineArray&) = delete;
+    InlineArray& operator=(const InlineArray&) = delete;
+
+    [[nodiscard]] iterator begin() noexcept;
+    [[nodiscard]] iterator end() noexcept;
+    [[nodiscard]] const_iterator begin() const noexcept;
+    [[nodiscard]] const_iterator end() const noexcept;
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+    [[nodiscard]] T& operator[](size_type index) noexcept;
+    [[nodiscard]] const T& operator[](size_type index) const noexcept;
+    [[nodiscard]] T& at(size_type index);
+    [[nodiscard]] const T& at(size_type index) const;
+    [[nodiscard]] T& front() noexcept;
+    [[nodiscard]] const T& front() const noexcept;
+    [[nodiscard]] T& back() noexcept;
+    [[nodiscard]] const T& back() const noexcept;
+
+    iterator insert(const_iterator pos, T value);
+    template<class InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last);
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+    void pop_back() noexcept;
+    void clear() noexcept;
+
+private:
+    void Relocate_(size_type from, size_type to) noexcept;
+
+private:
+    T* data_{ nullptr };
+    size_type size_{ 0 };
+    size_type capacity_{ 0 };
+};
+
+} // namespace s21
+
+#include "inline_array.tpp"
+
+#endif // TRANSACTIONS_INCLUDE_BPT_INLINE_ARRAY_H_
@@ -0,0 +1,236 @@
+#ifndef TRANSACTIONS_INCLUDE_BPT_INLINE_ARRAY_TPP_
+#define TRANSACTIONS_INCLUDE_BPT_INLINE_ARRAY_TPP_
+
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21
+{
+
+template<class T>
+InlineArray<T>::InlineArray(T* data, size_type capacity) noexcept
+    : data_(data)
+    , capacity_(capacity)
+{}
+
+template<class T>
+InlineArray<T>::~InlineArray()
+{
+    clear();
+}
+
+template<class T>
+typename InlineArray<T>::iterator InlineArray<T>::begin() noexcept
+{
+    return data_;
+}
+
+template<class T>
+typename InlineArray<T>::iterator InlineArray<T>::end() noexcept
+{
+    return data_ + size_;
+}
+
+template<class T>
+typename InlineArray<T>::const_iterator InlineArray<T>::begin() const noexcept
+{
+    return data_;
+}
+
+template<class T>
+typename InlineArray<T>::const_iterator InlineArray<T>::end() const noexcept
+{
+    return data_ + size_;
+}
+
+template<class T>
+typename InlineArray<T>::size_type InlineArray<T>::size() const noexcept
+{
+    return size_;
+}
+
+template<class T>
+typename InlineArray<T>::size_type InlineArray<T>::capacity() const noexcept
+{
+    return capacity_;
+}
+
+template<class T>
+bool InlineArray<T>::empty() const noexcept
+{
+    return size_ == 0;
+}
+
+template<class T>
+T& InlineArray<T>::operator[](size_type index) noexcept
+{
+    return data_[index];
+}
+
+template<class T>
+const T& InlineArray<T>::operator[](size_type index) const noexcept
+{
+    return data_[index];
+}
+
+template<class T>
+T& InlineArray<T>::at(size_type index)
+{
+    if (index >= size_)
+    {
+        throw std::out_of_range("The index is out of range.");
+    }
+
+    return data_[index];
+}
+
+template<class T>
+const T& InlineArray<T>::at(size_type index) const
+{
+    if (index >= size_)
+    {
+        throw std::out_of_range("The index is out of range.");
+    }
+
+    return data_[index];
+}
+
+template<class T>
+T& InlineArray<T>::front() noexcept
+{
+    return data_[0];
+}
+
+template<class T>
+const T& InlineArray<T>::front() const noexcept
+{
+    return data_[0];
+}
+
+template<class T>
+T& InlineArray<T>::back() noexcept
+{
+    return data_[size_ - 1];
+}
+
+template<class T>
+const T& InlineArray<T>::back() const noexcept
+{
+    return data_[size_ - 1];
+}
+
+template<class T>
+typename InlineArray<T>::iterator InlineArray<T>::insert(const_iterator pos, T value)
+{
+    if (size_ == capacity_)
+    {
+        throw std::length_error("The array is full.");
+    }
+
+    auto index = static_cast<size_type>(pos - data_);
+
+    for (auto i = size_; i > index; --i)
+    {
+        Relocate_(i - 1, i);
+    }
+    ::new (static_cast<void*>(data_ + index)) T(std::move(value));
+    ++size_;
+
+    return data_ + index;
+}
+
+template<class T>
+template<class InputIt>
+typename InlineArray<T>::iterator InlineArray<T>::insert(const_iterator pos, InputIt first, InputIt last)
+{
+    auto index = static_cast<size_type>(pos - data_);
+    auto count = static_cast<size_type>(std::distance(first, last));
+
+    if (count > capacity_ - size_)
+    {
+        throw std::length_error("The array is full.");
+    }
+
+    for (auto i = size_; i > index; --i)
+    {
+        Relocate_(i - 1, i - 1 + count);
+    }
+
+    // If a copy throws, the copies made so far are destroyed and the tail moves back.
+    auto i = index;
+    try
+    {
+        for (; first != last; ++first, ++i)
+        {
+            ::new (static_cast<void*>(data_ + i)) T(*first);
+        }
+    }
+    catch (...)
+    {
+        for (auto j = index; j < i; ++j)
+        {
+            data_[j].~T();
+        }
+        for (auto j = index; j < size_; ++j)
+        {
+            Relocate_(j + count, j);
+        }
+        throw;
+    }
+    size_ += count;
+
+    return data_ + index;
+}
+
+template<class T>
+typename InlineArray<T>::iterator InlineArray<T>::erase(const_iterator pos)
+{
+    return erase(pos, pos + 1);
+}
+
+template<class T>
+typename InlineArray<T>::iterator InlineArray<T>::erase(const_iterator first, const_iterator last)
+{
+    auto index = static_cast<size_type>(first - data_);
+    auto count = static_cast<size_type>(last - first);
+
+    for (auto i = index; i < index + count; ++i)
+    {
+        data_[i].~T();
+    }
+    for (auto i = index + count; i < size_; ++i)
+    {
+        Relocate_(i, i - count);
+    }
+    size_ -= count;
+
+    return data_ + index;
+}
+
+template<class T>
+void InlineArray<T>::pop_back() noexcept
+{
+    data_[--size_].~T();
+}
+
+template<class T>
+void InlineArray<T>::clear() noexcept
+{
+    for (size_type i = 0; i < size_; ++i)
+    {
+        data_[i].~T();
+    }
+    size_ = 0;
+}
+
+template<class T>
+void InlineArray<T>::Relocate_(size_type from, size_type to) noexcept
+{
+    ::new (static_cast<void*>(data_ + to)) T(std::move(data_[from]));
+    data_[from].~T();
+}
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_BPT_INLINE_ARRAY_TPP_
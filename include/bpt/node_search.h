@@ -0,0 +1,214 @@
+#ifndef TRANSACTIONS_INCLUDE_BPT_NODE_SEARCH_H_
+#define TRANSACTIONS_INCLUDE_BPT_NODE_SEARCH_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace s21
+{
+
+/*
+Search policies for BPlusTree nodes. A policy returns the index of the first key
+of a node that is not less than the searched key. A policy may keep one hint per
+key in the node (kUsesHints): the node keeps the hints in step with its keys
+through MakeHint and passes them to LowerBound next to the keys.
+*/
+
+namespace node_search_detail
+{
+
+// Counts the leading elements of a sorted array that are less than value.
+// The loop has no data dependent branches, so the compiler can vectorize it.
+template<class T>
+std::size_t CountLess(const T* data, std::size_t size, T value) noexcept
+{
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        count += static_cast<std::size_t>(data[i] < value);
+    }
+
+    return count;
+}
+
+#if defined(__AVX2__)
+inline std::size_t CountLess(const std::int64_t* data, std::size_t size, std::int64_t value) noexcept
+{
+    auto target = _mm256_set1_epi64x(value);
+    std::size_t count = 0;
+    std::size_t i = 0;
+
+    for (; i + 4 <= size; i += 4)
+    {
+        auto keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        auto mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(target, keys)));
+
+        count += __builtin_popcount(mask);
+        if (mask != 0xF)
+        {
+            return count;
+        }
+    }
+
+    return count + CountLess<std::int64_t>(data + i, size - i, value);
+}
+
+inline std::size_t CountLess(const std::int32_t* data, std::size_t size, std::int32_t value) noexcept
+{
+    auto target = _mm256_set1_epi32(value);
+    std::size_t count = 0;
+    std::size_t i = 0;
+
+    for (; i + 8 <= size; i += 8)
+    {
+        auto keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        auto mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(target, keys)));
+
+        count += __builtin_popcount(mask);
+        if (mask != 0xFF)
+        {
+            return count;
+        }
+    }
+
+    return count + CountLess<std::int32_t>(data + i, size - i, value);
+}
+#endif
+
+} // namespace node_search_detail
+
+// std::lower_bound over the keys.
+template<class Key>
+struct LowerBoundSearch
+{
+    using hint_type = std::byte;
+    static constexpr bool kUsesHints{ false };
+
+    static hint_type MakeHint(const Key&) noexcept
+    {
+        return {};
+    }
+
+    template<class KeyView>
+    static std::size_t LowerBound(const Key* keys, const hint_type*, std::size_t size, const KeyView& key)
+    {
+        return std::lower_bound(keys, keys + size, key) - keys;
+    }
+};
+
+// Binary search that halves the range with a conditional move instead of a branch.
+template<class Key>
+struct BranchlessSearch
+{
+    using hint_type = std::byte;
+    static constexpr bool kUsesHints{ false };
+
+    static hint_type MakeHint(const Key&) noexcept
+    {
+        return {};
+    }
+
+    template<class KeyView>
+    static std::size_t LowerBound(const Key* keys, const hint_type*, std::size_t size, const KeyView& key)
+    {
+        if (size == 0)
+        {
+            return 0;
+        }
+
+        auto base = keys;
+
+        while (size > 1)
+        {
+            auto half = size / 2;
+            base = (base[half] < key) ? base + half : base;
+            size -= half;
+        }
+
+        return (base - keys) + static_cast<std::size_t>(*base < key);
+    }
+};
+
+// Counts the keys less than the searched one, with AVX2 for 32 and 64 bit signed
+// keys when the compiler targets it. For integer keys only.
+template<class Key>
+struct SimdSearch
+{
+    static_assert(std::is_integral_v<Key>, "SimdSearch needs integer keys.");
+
+    using hint_type = std::byte;
+    static constexpr bool kUsesHints{ false };
+
+    static hint_type MakeHint(const Key&) noexcept
+    {
+        return {};
+    }
+
+    static std::size_t LowerBound(const Key* keys, const hint_type*, std::size_t size, Key key) noexcept
+    {
+        return node_search_detail::CountLess(keys, size, key);
+    }
+};
+
+// Keeps the first 8 bytes of every key as an integer that orders the same way as
+// the strings. The prefixes are counted like SimdSearch counts integer keys, and the
+// full strings are compared only among the keys that share the searched prefix.
+struct PrefixSearch
+{
+    using hint_type = std::int64_t;
+    static constexpr bool kUsesHints{ true };
+
+    static hint_type MakeHint(std::string_view key) noexcept
+    {
+        unsigned char bytes[sizeof(hint_type)]{};
+        std::uint64_t prefix = 0;
+
+        std::memcpy(bytes, key.data(), std::min(key.size(), sizeof(bytes)));
+        for (auto byte : bytes)
+        {
+            prefix = (prefix << 8) | byte;
+        }
+
+        // Flipping the sign bit keeps the unsigned order in a signed compare.
+        return static_cast<hint_type>(prefix ^ (std::uint64_t{ 1 } << 63));
+    }
+
+    static std::size_t LowerBound(const std::string* keys, const hint_type* hints, std::size_t size, std::string_view key)
+    {
+        auto hint = MakeHint(key);
+        auto first = node_search_detail::CountLess(hints, size, hint);
+        auto last = first;
+
+        while (last < size && hints[last] == hint)
+        {
+            ++last;
+        }
+
+        return std::lower_bound(keys + first, keys + last, key) - keys;
+    }
+};
+
+// The search used when BPlusTree is not given one. Without AVX2 the key count
+// is slower than a branchless binary search on integer keys.
+template<class Key>
+using DefaultNodeSearch = std::conditional_t<std::is_integral_v<Key>,
+#if defined(__AVX2__)
+    SimdSearch<Key>,
+#else
+    BranchlessSearch<Key>,
+#endif
+    std::conditional_t<std::is_same_v<Key, std::string>, PrefixSearch, LowerBoundSearch<Key>>>;
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_BPT_NODE_SEARCH_H_
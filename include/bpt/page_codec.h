@@ -0,0 +1,117 @@
+#ifndef TRANSACTIONS_INCLUDE_BPT_PAGE_CODEC_H_
+#define TRANSACTIONS_INCLUDE_BPT_PAGE_CODEC_H_
+
+#include <string>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "common/storage_struct.h"
+
+namespace s21
+{
+
+/*
+Writes keys and values into pages and reads them back. Size returns the number
+of bytes Write uses; Write and Read move the pointer past them. Read takes the
+end of the page and throws std::runtime_error rather than read past it, so a
+corrupt or truncated page file is reported instead of read out of bounds. Types
+stored by PagedBPlusTree need a specialisation.
+*/
+inline void CheckPageBytes(const char* in, const char* end, std::size_t size)
+{
+    if (end < in || static_cast<std::size_t>(end - in) < size)
+    {
+        throw std::runtime_error("The page is corrupt.");
+    }
+}
+
+template<class T, class = void>
+struct PageCodec;
+
+template<class T>
+struct PageCodec<T, std::enable_if_t<std::is_arithmetic_v<T>>>
+{
+    static std::size_t Size(const T&) noexcept
+    {
+        return sizeof(T);
+    }
+
+    static void Write(char*& out, const T& value) noexcept
+    {
+        std::memcpy(out, &value, sizeof(T));
+        out += sizeof(T);
+    }
+
+    static void Read(const char*& in, const char* end, T& value)
+    {
+        CheckPageBytes(in, end, sizeof(T));
+        std::memcpy(&value, in, sizeof(T));
+        in += sizeof(T);
+    }
+};
+
+// The length comes first, as 32 bits.
+template<>
+struct PageCodec<std::string>
+{
+    using length_type = std::uint32_t;
+
+    static std::size_t Size(const std::string& value) noexcept
+    {
+        return sizeof(length_type) + value.size();
+    }
+
+    static void Write(char*& out, const std::string& value) noexcept
+    {
+        PageCodec<length_type>::Write(out, static_cast<length_type>(value.size()));
+        std::memcpy(out, value.data(), value.size());
+        out += value.size();
+    }
+
+    static void Read(const char*& in, const char* end, std::string& value)
+    {
+        length_type length = 0;
+
+        PageCodec<length_type>::Read(in, end, length);
+        CheckPageBytes(in, end, length);
+        value.assign(in, length);
+        in += length;
+    }
+};
+
+template<>
+struct PageCodec<Value>
+{
+    static std::size_t Size(const Value& value) noexcept
+    {
+        return PageCodec<std::string>::Size(value.last_name) + PageCodec<std::string>::Size(value.first_name)
+               + PageCodec<int>::Size(value.birth_year) + PageCodec<std::string>::Size(value.city)
+               + PageCodec<int>::Size(value.coins);
+    }
+
+    static void Write(char*& out, const Value& value) noexcept
+    {
+        PageCodec<std::string>::Write(out, value.last_name);
+        PageCodec<std::string>::Write(out, value.first_name);
+        PageCodec<int>::Write(out, value.birth_year);
+        PageCodec<std::string>::Write(out, value.city);
+        PageCodec<int>::Write(out, value.coins);
+    }
+
+    // Fills the fields directly: assigning a Value would keep the fields that are "-" in the page.
+    static void Read(const char*& in, const char* end, Value& value)
+    {
+        PageCodec<std::string>::Read(in, end, value.last_name);
+        PageCodec<std::string>::Read(in, end, value.first_name);
+        PageCodec<int>::Read(in, end, value.birth_year);
+        PageCodec<std::string>::Read(in, end, value.city);
+        PageCodec<int>::Read(in, end, value.coins);
+    }
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_BPT_PAGE_CODEC_H_
@@ -0,0 +1,165 @@
+#ifndef TRANSACTIONS_INCLUDE_BPT_PAGED_B_PLUS_TREE_H_
+#define TRANSACTIONS_INCLUDE_BPT_PAGED_B_PLUS_TREE_H_
+
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+#include <utility>
+#include <cstddef>
+
+#include "common/ordered_storage_interface.h"
+#include "common/page_file.h"
+#include "buffer_pool.h"
+#include "page_codec.h"
+
+namespace s21
+{
+
+/*
+B+ tree whose nodes live in the pages of a file and are addressed by page id.
+Only the pages in the BufferPool are in memory, so the memory the tree uses is
+bounded by the pool size however much data the file holds. Keys and values are
+stored with PageCodec.
+
+Nodes hold as many entries as fit in a page: a node is split when its encoded
+size outgrows the page, and merged with a sibling when both fit in three quarters
+of one. An entry may take at most a quarter of a page. A node is only written to
+its page when it is evicted from the pool or flushed.
+
+The file keeps the tree: opening it again with the same page size gives back the
+tree that was flushed to it. Flush is called by the destructor.
+
+A reference returned by GetValue stays valid until the next call on the tree,
+which also writes the value back to its page if it was changed through the
+reference. A change that makes the entry too large for a page is undone.
+*/
+template<class Key, class Tp = Value>
+class PagedBPlusTree : public OrderedKeyValueStorageInterface<Key, Tp>
+{
+public:
+    using key_type = typename OrderedKeyValueStorageInterface<Key, Tp>::key_type;
+    using mapped_type = typename OrderedKeyValueStorageInterface<Key, Tp>::mapped_type;
+    using size_type = typename OrderedKeyValueStorageInterface<Key, Tp>::size_type;
+    using key_view_type = typename OrderedKeyValueStorageInterface<Key, Tp>::key_view_type;
+    using ScanCursor = typename OrderedKeyValueStorageInterface<Key, Tp>::ScanCursor;
+    using ScanResult = typename OrderedKeyValueStorageInterface<Key, Tp>::ScanResult;
+    using page_id_type = PageFile::page_id_type;
+
+private:
+    // A node as it is kept in the buffer pool. Leaves have keys and values and the
+    // page of the next leaf; internal nodes have keys and one more child than keys.
+    class PagedNode
+    {
+    public:
+        using key_type = PagedBPlusTree::key_type;
+        using mapped_type = PagedBPlusTree::mapped_type;
+        using size_type = PagedBPlusTree::size_type;
+
+        // The leaf flag, the number of keys and either the next leaf or the first child.
+        static constexpr size_type kHeaderSize{ sizeof(std::uint8_t) + sizeof(std::uint32_t) + sizeof(page_id_type) };
+
+    public:
+        void Encode(char* data, size_type size) const;
+        void Decode(const char* data, size_type size);
+
+        [[nodiscard]] bool IsLeaf() const noexcept;
+        [[nodiscard]] size_type EncodedSize() const noexcept;
+        [[nodiscard]] size_type Size() const noexcept;
+        [[nodiscard]] const std::vector<key_type>& Keys() const noexcept;
+        [[nodiscard]] std::vector<mapped_type>& Values() noexcept;
+        [[nodiscard]] const std::vector<page_id_type>& Children() const noexcept;
+        [[nodiscard]] page_id_type GetNext() const noexcept;
+
+        void SetNext(page_id_type next) noexcept;
+        void MakeRoot(page_id_type left, key_type separator, page_id_type right);
+        void Insert(size_type index, key_type key, mapped_type value);
+        void Erase(size_type index);
+        void InsertChild(size_type index, key_type separator, page_id_type child);
+        key_type EraseChild(size_type index);
+        // Moves about half of the bytes to the empty node right and returns the key that separates them.
+        key_type MoveHalf(PagedNode& right);
+        void Append(PagedNode& right, key_type separator);
+        // Counts the encoded size again, after a value was changed in place.
+        void Recount() noexcept;
+
+        static size_type EntrySize(const key_type& key, const mapped_type& value) noexcept;
+        static size_type SeparatorSize(const key_type& key) noexcept;
+
+    private:
+        static void InsertValue_(std::vector<mapped_type>& values, size_type index, mapped_type value);
+        static void EraseValue_(std::vector<mapped_type>& values, size_type index);
+
+    private:
+        bool leaf_{ true };
+        page_id_type next_{ PageFile::kNoPage };
+        std::vector<key_type> keys_;
+        std::vector<mapped_type> values_;
+        std::vector<page_id_type> children_;
+        size_type bytes_{ kHeaderSize };
+    };
+    using Node = PagedNode;
+    using pool_type = BufferPool<Node>;
+    using Handle = typename pool_type::Handle;
+    // An internal node on the way to a leaf and the index of the child taken from it.
+    using Path = std::vector<std::pair<page_id_type, size_type>>;
+
+public:
+    static constexpr size_type kDefaultPageSize{ 4096 };
+    static constexpr size_type kDefaultPoolPages{ 256 };
+    // A split or a merge pins up to three pages, and GetValue keeps one more.
+    static constexpr size_type kMinPoolPages{ 8 };
+
+public:
+    explicit PagedBPlusTree(const std::filesystem::path& path, size_type pool_pages = kDefaultPoolPages,
+                            size_type page_size = kDefaultPageSize);
+    ~PagedBPlusTree() override;
+
+    PagedBPlusTree(const PagedBPlusTree&) = delete;
+    PagedBPlusTree& operator=(const PagedBPlusTree&) = delete;
+
+    bool Insert(key_type key, mapped_type value) override;
+    mapped_type& GetValue(key_view_type key) override;
+    bool Exists(key_view_type key) override;
+    bool Erase(key_view_type key) override;
+    std::vector<std::pair<key_type, mapped_type>> ShowAll() override;
+    ScanResult Scan(const ScanCursor& cursor, size_type count) override;
+    std::vector<std::pair<key_type, mapped_type>> RangeScan(key_view_type lower, key_view_type upper, size_type limit) override;
+    std::vector<std::pair<key_type, mapped_type>> PrefixScan(key_view_type prefix, size_type limit) override;
+    [[nodiscard]] size_type Size() const override;
+    // Writes every changed page and the root to the file.
+    void Flush();
+
+    [[nodiscard]] size_type NumPageReads() const noexcept;
+    [[nodiscard]] size_type NumPageWrites() const noexcept;
+
+private:
+    Handle FindLeaf_(key_view_type key, Path* path);
+    Handle FindFirstLeaf_();
+    void Split_(Handle node, Path& path);
+    void Rebalance_(Handle node, Path& path);
+    void ReleaseReturnedValue_();
+    template<class Visitor>
+    void ForEachFrom_(Handle leaf, size_type index, Visitor visitor);
+    [[nodiscard]] size_type MaxEntrySize_() const noexcept;
+
+private:
+    // Slots of PageFile::UserValue.
+    static constexpr size_type kRootSlot{ 0 };
+    static constexpr size_type kSizeSlot{ 1 };
+
+    PageFile file_;
+    pool_type pool_;
+    page_id_type root_{ PageFile::kNoPage };
+    size_type num_elements_{ 0 };
+    // The page of the value GetValue returned last, and that value as it was encoded.
+    Handle returned_page_;
+    size_type returned_index_{ 0 };
+    std::vector<char> returned_bytes_;
+};
+
+} // namespace s21
+
+#include "paged_b_plus_tree.tpp"
+#include "paged_b_plus_tree_node.tpp"
+
+#endif // TRANSACTIONS_INCLUDE_BPT_PAGED_B_PLUS_TREE_H_
@@ -0,0 +1,453 @@
+#ifndef TRANSACTIONS_INCLUDE_BPT_PAGED_B_PLUS_TREE_TPP_
+#define TRANSACTIONS_INCLUDE_BPT_PAGED_B_PLUS_TREE_TPP_
+
+#include <stdexcept>
+
+namespace s21
+{
+
+template<class Key, class Tp>
+PagedBPlusTree<Key, Tp>::PagedBPlusTree(const std::filesystem::path& path, size_type pool_pages, size_type page_size)
+    : file_(path, page_size)
+    , pool_(file_, pool_pages)
+{
+    if (pool_pages < kMinPoolPages)
+    {
+        throw std::invalid_argument("The buffer pool cannot have less than 8 pages.");
+    }
+
+    root_ = file_.UserValue(kRootSlot);
+    num_elements_ = file_.UserValue(kSizeSlot);
+    if (root_ == PageFile::kNoPage)
+    {
+        auto root = pool_.Create();
+        root_ = root.Id();
+    }
+}
+
+template<class Key, class Tp>
+PagedBPlusTree<Key, Tp>::~PagedBPlusTree()
+{
+    try
+    {
+        Flush();
+    }
+    catch (const std::exception&)
+    {
+    }
+}
+
+template<class Key, class Tp>
+bool PagedBPlusTree<Key, Tp>::Insert(key_type key, mapped_type value)
+{
+    ReleaseReturnedValue_();
+    if (std::max(Node::EntrySize(key, value), Node::SeparatorSize(key)) > MaxEntrySize_())
+    {
+        throw std::invalid_argument("The entry is too large for a page.");
+    }
+
+    Path path;
+    auto leaf = FindLeaf_(key, &path);
+    auto& keys = leaf->Keys();
+    auto index = static_cast<size_type>(std::lower_bound(keys.begin(), keys.end(), key) - keys.begin());
+
+    if (index < keys.size() && keys[index] == key)
+    {
+        return false;
+    }
+
+    leaf->Insert(index, std::move(key), std::move(value));
+    leaf.MarkDirty();
+    ++num_elements_;
+    if (leaf->EncodedSize() > file_.PageSize())
+    {
+        Split_(std::move(leaf), path);
+    }
+
+    return true;
+}
+
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::mapped_type& PagedBPlusTree<Key, Tp>::GetValue(key_view_type key)
+{
+    ReleaseReturnedValue_();
+
+    auto leaf = FindLeaf_(key, nullptr);
+    auto& keys = leaf->Keys();
+    auto index = static_cast<size_type>(std::lower_bound(keys.begin(), keys.end(), key) - keys.begin());
+
+    if (index == keys.size() || !(keys[index] == key))
+    {
+        throw std::runtime_error("The value was not found.");
+    }
+
+    auto& value = leaf->Values()[index];
+
+    returned_bytes_.resize(PageCodec<mapped_type>::Size(value));
+    auto out = returned_bytes_.data();
+    PageCodec<mapped_type>::Write(out, value);
+    returned_index_ = index;
+    returned_page_ = std::move(leaf);
+
+    return value;
+}
+
+template<class Key, class Tp>
+bool PagedBPlusTree<Key, Tp>::Exists(key_view_type key)
+{
+    ReleaseReturnedValue_();
+
+    auto leaf = FindLeaf_(key, nullptr);
+    auto& keys = leaf->Keys();
+
+    return std::binary_search(keys.begin(), keys.end(), key);
+}
+
+template<class Key, class Tp>
+bool PagedBPlusTree<Key, Tp>::Erase(key_view_type key)
+{
+    ReleaseReturnedValue_();
+
+    Path path;
+    auto leaf = FindLeaf_(key, &path);
+    auto& keys = leaf->Keys();
+    auto index = static_cast<size_type>(std::lower_bound(keys.begin(), keys.end(), key) - keys.begin());
+
+    if (index == keys.size() || !(keys[index] == key))
+    {
+        return false;
+    }
+
+    leaf->Erase(index);
+    leaf.MarkDirty();
+    --num_elements_;
+    Rebalance_(std::move(leaf), path);
+
+    return true;
+}
+
+template<class Key, class Tp>
+std::vector<std::pair<typename PagedBPlusTree<Key, Tp>::key_type, typename PagedBPlusTree<Key, Tp>::mapped_type>>
+PagedBPlusTree<Key, Tp>::ShowAll()
+{
+    std::vector<std::pair<key_type, mapped_type>> entries;
+
+    ReleaseReturnedValue_();
+    entries.reserve(num_elements_);
+    ForEachFrom_(FindFirstLeaf_(), 0, [&entries](const key_type& key, const mapped_type& value)
+    {
+        entries.emplace_back(key, value);
+        return true;
+    });
+
+    return entries;
+}
+
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::ScanResult PagedBPlusTree<Key, Tp>::Scan(const ScanCursor& cursor, size_type count)
+{
+    ScanResult result;
+
+    ReleaseReturnedValue_();
+    result.cursor.finished = true;
+    if (cursor.finished)
+    {
+        return result;
+    }
+
+    auto leaf = cursor.last_key ? FindLeaf_(*cursor.last_key, nullptr) : FindFirstLeaf_();
+    auto& keys = leaf->Keys();
+    auto index = cursor.last_key ? static_cast<size_type>(std::upper_bound(keys.begin(), keys.end(), *cursor.last_key) - keys.begin()) : 0;
+
+    ForEachFrom_(std::move(leaf), index, [&result, count](const key_type& key, const mapped_type& value)
+    {
+        if (result.entries.size() == count)
+        {
+            result.cursor.finished = false;
+            return false;
+        }
+
+        result.entries.emplace_back(key, value);
+        return true;
+    });
+
+    result.cursor.last_key = result.entries.empty() ? cursor.last_key : result.entries.back().first;
+
+    return result;
+}
+
+template<class Key, class Tp>
+std::vector<std::pair<typename PagedBPlusTree<Key, Tp>::key_type, typename PagedBPlusTree<Key, Tp>::mapped_type>>
+PagedBPlusTree<Key, Tp>::RangeScan(key_view_type lower, key_view_type upper, size_type limit)
+{
+    std::vector<std::pair<key_type, mapped_type>> entries;
+
+    ReleaseReturnedValue_();
+
+    auto leaf = FindLeaf_(lower, nullptr);
+    auto& keys = leaf->Keys();
+    auto index = static_cast<size_type>(std::lower_bound(keys.begin(), keys.end(), lower) - keys.begin());
+
+    ForEachFrom_(std::move(leaf), index, [&entries, &upper, limit](const key_type& key, const mapped_type& value)
+    {
+        if ((limit != 0 && entries.size() == limit) || upper < key)
+        {
+            return false;
+        }
+
+        entries.emplace_back(key, value);
+        return true;
+    });
+
+    return entries;
+}
+
+template<class Key, class Tp>
+std::vector<std::pair<typename PagedBPlusTree<Key, Tp>::key_type, typename PagedBPlusTree<Key, Tp>::mapped_type>>
+PagedBPlusTree<Key, Tp>::PrefixScan(key_view_type prefix, size_type limit)
+{
+    std::vector<std::pair<key_type, mapped_type>> entries;
+
+    ReleaseReturnedValue_();
+
+    auto leaf = FindLeaf_(prefix, nullptr);
+    auto& keys = leaf->Keys();
+    auto index = static_cast<size_type>(std::lower_bound(keys.begin(), keys.end(), prefix) - keys.begin());
+
+    ForEachFrom_(std::move(leaf), index, [&entries, &prefix, limit](const key_type& key, const mapped_type& value)
+    {
+        if ((limit != 0 && entries.size() == limit) || !OrderedKeyValueStorageInterface<Key, Tp>::HasPrefix(key, prefix))
+        {
+            return false;
+        }
+
+        entries.emplace_back(key, value);
+        return true;
+    });
+
+    return entries;
+}
+
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::size_type PagedBPlusTree<Key, Tp>::Size() const
+{
+    return num_elements_;
+}
+
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::Flush()
+{
+    ReleaseReturnedValue_();
+    pool_.FlushAll();
+    file_.SetUserValue(kRootSlot, root_);
+    file_.SetUserValue(kSizeSlot, num_elements_);
+    file_.Sync();
+}
+
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::size_type PagedBPlusTree<Key, Tp>::NumPageReads() const noexcept
+{
+    return file_.NumReads();
+}
+
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::size_type PagedBPlusTree<Key, Tp>::NumPageWrites() const noexcept
+{
+    return file_.NumWrites();
+}
+
+// Records the internal nodes passed on the way in path, if it is given.
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::Handle PagedBPlusTree<Key, Tp>::FindLeaf_(key_view_type key, Path* path)
+{
+    auto node = pool_.Fetch(root_);
+
+    while (!node->IsLeaf())
+    {
+        auto& keys = node->Keys();
+        auto index = static_cast<size_type>(std::upper_bound(keys.begin(), keys.end(), key) - keys.begin());
+
+        if (path != nullptr)
+        {
+            path->emplace_back(node.Id(), index);
+        }
+        node = pool_.Fetch(node->Children()[index]);
+    }
+
+    return node;
+}
+
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::Handle PagedBPlusTree<Key, Tp>::FindFirstLeaf_()
+{
+    auto node = pool_.Fetch(root_);
+
+    while (!node->IsLeaf())
+    {
+        node = pool_.Fetch(node->Children().front());
+    }
+
+    return node;
+}
+
+// Splits node and then every node on the path that outgrows its page in turn.
+// The new node goes to the right, so that the list of leaves stays in key order.
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::Split_(Handle node, Path& path)
+{
+    while (node->EncodedSize() > file_.PageSize())
+    {
+        auto right = pool_.Create();
+        auto separator = node->MoveHalf(*right);
+
+        if (node->IsLeaf())
+        {
+            right->SetNext(node->GetNext());
+            node->SetNext(right.Id());
+        }
+        node.MarkDirty();
+
+        if (path.empty())
+        {
+            auto root = pool_.Create();
+
+            root->MakeRoot(node.Id(), std::move(separator), right.Id());
+            root_ = root.Id();
+            return;
+        }
+
+        auto [parent_id, index] = path.back();
+        path.pop_back();
+        node = pool_.Fetch(parent_id);
+        node->InsertChild(index, std::move(separator), right.Id());
+        node.MarkDirty();
+    }
+}
+
+// Merges node with a sibling under the same parent while it is less than a quarter
+// full and both fit in three quarters of a page, going up as the parents shrink.
+// Nodes that cannot be merged stay as they are. A root left with one child is
+// replaced by it.
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::Rebalance_(Handle node, Path& path)
+{
+    auto page_size = file_.PageSize();
+
+    while (!path.empty() && node->EncodedSize() < page_size / 4)
+    {
+        auto [parent_id, index] = path.back();
+        path.pop_back();
+        auto parent = pool_.Fetch(parent_id);
+
+        if (parent->Size() == 0)
+        {
+            node = std::move(parent);
+            continue;
+        }
+
+        auto separator_index = index < parent->Size() ? index : index - 1;
+        auto left = separator_index == index ? std::move(node) : pool_.Fetch(parent->Children()[separator_index]);
+        auto right = separator_index == index ? pool_.Fetch(parent->Children()[index + 1]) : std::move(node);
+        auto merged_size = left->EncodedSize() + right->EncodedSize() - Node::kHeaderSize;
+
+        if (!left->IsLeaf())
+        {
+            merged_size += Node::SeparatorSize(parent->Keys()[separator_index]);
+        }
+        if (merged_size > page_size * 3 / 4)
+        {
+            break;
+        }
+
+        left->Append(*right, parent->EraseChild(separator_index));
+        left.MarkDirty();
+        parent.MarkDirty();
+        pool_.Free(std::move(right));
+        node = std::move(parent);
+    }
+
+    node.Reset();
+    for (auto root = pool_.Fetch(root_); !root->IsLeaf() && root->Size() == 0; root = pool_.Fetch(root_))
+    {
+        root_ = root->Children().front();
+        pool_.Free(std::move(root));
+    }
+}
+
+// Writes the value GetValue returned last to its page if it was changed through
+// the reference, and lets the page be evicted again. A leaf the value no longer
+// fits in is split; a value that would not fit in any page is set back.
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::ReleaseReturnedValue_()
+{
+    if (!returned_page_)
+    {
+        return;
+    }
+
+    auto leaf = std::move(returned_page_);
+    auto& key = leaf->Keys()[returned_index_];
+    auto& value = leaf->Values()[returned_index_];
+    std::vector<char> bytes(PageCodec<mapped_type>::Size(value));
+    auto out = bytes.data();
+
+    PageCodec<mapped_type>::Write(out, value);
+    if (bytes == returned_bytes_)
+    {
+        return;
+    }
+
+    if (std::max(Node::EntrySize(key, value), Node::SeparatorSize(key)) > MaxEntrySize_())
+    {
+        const char* in = returned_bytes_.data();
+        PageCodec<mapped_type>::Read(in, in + returned_bytes_.size(), value);
+        return;
+    }
+
+    leaf->Recount();
+    leaf.MarkDirty();
+    if (leaf->EncodedSize() > file_.PageSize())
+    {
+        Path path;
+        auto leaf_key = key;
+
+        leaf.Reset();
+        Split_(FindLeaf_(leaf_key, &path), path);
+    }
+}
+
+template<class Key, class Tp>
+template<class Visitor>
+void PagedBPlusTree<Key, Tp>::ForEachFrom_(Handle leaf, size_type index, Visitor visitor)
+{
+    for (;;)
+    {
+        auto& keys = leaf->Keys();
+        auto& values = leaf->Values();
+
+        for (; index < keys.size(); ++index)
+        {
+            if (!visitor(keys[index], values[index]))
+            {
+                return;
+            }
+        }
+
+        if (leaf->GetNext() == PageFile::kNoPage)
+        {
+            return;
+        }
+        leaf = pool_.Fetch(leaf->GetNext());
+        index = 0;
+    }
+}
+
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::size_type PagedBPlusTree<Key, Tp>::MaxEntrySize_() const noexcept
+{
+    return (file_.PageSize() - Node::kHeaderSize) / 4;
+}
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_BPT_PAGED_B_PLUS_TREE_TPP_
@@ -0,0 +1,309 @@
+#ifndef TRANSACTIONS_INCLUDE_BPT_PAGED_B_PLUS_TREE_NODE_TPP_
+#define TRANSACTIONS_INCLUDE_BPT_PAGED_B_PLUS_TREE_NODE_TPP_
+
+#include <stdexcept>
+#include <new>
+
+namespace s21
+{
+
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::PagedNode::Encode(char* data, size_type size) const
+{
+    if (bytes_ > size)
+    {
+        throw std::logic_error("The node does not fit in its page.");
+    }
+
+    PageCodec<std::uint8_t>::Write(data, static_cast<std::uint8_t>(leaf_));
+    PageCodec<std::uint32_t>::Write(data, static_cast<std::uint32_t>(keys_.size()));
+    PageCodec<page_id_type>::Write(data, leaf_ ? next_ : children_.front());
+    for (size_type i = 0; i < keys_.size(); ++i)
+    {
+        PageCodec<key_type>::Write(data, keys_[i]);
+        if (leaf_)
+        {
+            PageCodec<mapped_type>::Write(data, values_[i]);
+        }
+        else
+        {
+            PageCodec<page_id_type>::Write(data, children_[i + 1]);
+        }
+    }
+}
+
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::PagedNode::Decode(const char* data, size_type size)
+{
+    auto in = data;
+    auto end = data + size;
+    std::uint8_t leaf = 0;
+    std::uint32_t count = 0;
+    page_id_type first = PageFile::kNoPage;
+
+    PageCodec<std::uint8_t>::Read(in, end, leaf);
+    PageCodec<std::uint32_t>::Read(in, end, count);
+    PageCodec<page_id_type>::Read(in, end, first);
+
+    leaf_ = leaf != 0;
+    next_ = leaf_ ? first : PageFile::kNoPage;
+    keys_.clear();
+    values_.clear();
+    children_.clear();
+    if (!leaf_)
+    {
+        children_.push_back(first);
+    }
+
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        PageCodec<key_type>::Read(in, end, keys_.emplace_back());
+        if (leaf_)
+        {
+            PageCodec<mapped_type>::Read(in, end, values_.emplace_back());
+        }
+        else
+        {
+            PageCodec<page_id_type>::Read(in, end, children_.emplace_back());
+        }
+    }
+    bytes_ = static_cast<size_type>(in - data);
+}
+
+template<class Key, class Tp>
+bool PagedBPlusTree<Key, Tp>::PagedNode::IsLeaf() const noexcept
+{
+    return leaf_;
+}
+
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::PagedNode::size_type PagedBPlusTree<Key, Tp>::PagedNode::EncodedSize() const noexcept
+{
+    return bytes_;
+}
+
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::PagedNode::size_type PagedBPlusTree<Key, Tp>::PagedNode::Size() const noexcept
+{
+    return keys_.size();
+}
+
+template<class Key, class Tp>
+const std::vector<typename PagedBPlusTree<Key, Tp>::PagedNode::key_type>& PagedBPlusTree<Key, Tp>::PagedNode::Keys() const noexcept
+{
+    return keys_;
+}
+
+template<class Key, class Tp>
+std::vector<typename PagedBPlusTree<Key, Tp>::PagedNode::mapped_type>& PagedBPlusTree<Key, Tp>::PagedNode::Values() noexcept
+{
+    return values_;
+}
+
+template<class Key, class Tp>
+const std::vector<typename PagedBPlusTree<Key, Tp>::page_id_type>& PagedBPlusTree<Key, Tp>::PagedNode::Children() const noexcept
+{
+    return children_;
+}
+
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::page_id_type PagedBPlusTree<Key, Tp>::PagedNode::GetNext() const noexcept
+{
+    return next_;
+}
+
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::PagedNode::SetNext(page_id_type next) noexcept
+{
+    next_ = next;
+}
+
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::PagedNode::MakeRoot(page_id_type left, key_type separator, page_id_type right)
+{
+    leaf_ = false;
+    next_ = PageFile::kNoPage;
+    keys_.clear();
+    values_.clear();
+    children_.assign({ left });
+    bytes_ = kHeaderSize;
+    InsertChild(0, std::move(separator), right);
+}
+
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::PagedNode::Insert(size_type index, key_type key, mapped_type value)
+{
+    bytes_ += EntrySize(key, value);
+    keys_.insert(keys_.begin() + static_cast<std::ptrdiff_t>(index), std::move(key));
+    InsertValue_(values_, index, std::move(value));
+}
+
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::PagedNode::Erase(size_type index)
+{
+    bytes_ -= EntrySize(keys_[index], values_[index]);
+    keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(index));
+    EraseValue_(values_, index);
+}
+
+// The separator goes to keys[index] and the child to the right of it.
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::PagedNode::InsertChild(size_type index, key_type separator, page_id_type child)
+{
+    bytes_ += SeparatorSize(separator);
+    keys_.insert(keys_.begin() + static_cast<std::ptrdiff_t>(index), std::move(separator));
+    children_.insert(children_.begin() + static_cast<std::ptrdiff_t>(index) + 1, child);
+}
+
+// Removes keys[index] and the child to the right of it, and returns the key.
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::PagedNode::key_type PagedBPlusTree<Key, Tp>::PagedNode::EraseChild(size_type index)
+{
+    auto separator = std::move(keys_[index]);
+
+    bytes_ -= SeparatorSize(separator);
+    keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(index));
+    children_.erase(children_.begin() + static_cast<std::ptrdiff_t>(index) + 1);
+
+    return separator;
+}
+
+// Leaves copy the first key of right up; internal nodes move their middle key up.
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::PagedNode::key_type PagedBPlusTree<Key, Tp>::PagedNode::MoveHalf(PagedNode& right)
+{
+    auto half = (bytes_ - kHeaderSize) / 2;
+    size_type middle = 0;
+
+    for (size_type moved = 0; middle + 1 < keys_.size() && moved < half; ++middle)
+    {
+        moved += leaf_ ? EntrySize(keys_[middle], values_[middle]) : SeparatorSize(keys_[middle]);
+    }
+    middle = std::max<size_type>(middle, 1);
+
+    right.leaf_ = leaf_;
+    right.keys_.clear();
+    right.values_.clear();
+    right.children_.clear();
+
+    key_type separator;
+    if (leaf_)
+    {
+        for (auto i = middle; i < keys_.size(); ++i)
+        {
+            right.keys_.push_back(std::move(keys_[i]));
+            right.values_.push_back(std::move(values_[i]));
+        }
+        keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(middle), keys_.end());
+        values_.erase(values_.begin() + static_cast<std::ptrdiff_t>(middle), values_.end());
+        separator = right.keys_.front();
+    }
+    else
+    {
+        separator = std::move(keys_[middle]);
+        for (auto i = middle + 1; i < keys_.size(); ++i)
+        {
+            right.keys_.push_back(std::move(keys_[i]));
+        }
+        for (auto i = middle + 1; i < children_.size(); ++i)
+        {
+            right.children_.push_back(children_[i]);
+        }
+        keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(middle), keys_.end());
+        children_.erase(children_.begin() + static_cast<std::ptrdiff_t>(middle) + 1, children_.end());
+    }
+
+    Recount();
+    right.Recount();
+
+    return separator;
+}
+
+// Takes over all entries of right, the node just after this one. Internal nodes
+// get the separator between them back as a key.
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::PagedNode::Append(PagedNode& right, key_type separator)
+{
+    if (leaf_)
+    {
+        for (size_type i = 0; i < right.keys_.size(); ++i)
+        {
+            keys_.push_back(std::move(right.keys_[i]));
+            values_.push_back(std::move(right.values_[i]));
+        }
+        next_ = right.next_;
+    }
+    else
+    {
+        keys_.push_back(std::move(separator));
+        for (auto& key : right.keys_)
+        {
+            keys_.push_back(std::move(key));
+        }
+        children_.insert(children_.end(), right.children_.begin(), right.children_.end());
+    }
+
+    right.keys_.clear();
+    right.values_.clear();
+    right.children_.clear();
+    Recount();
+    right.Recount();
+}
+
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::PagedNode::size_type
+PagedBPlusTree<Key, Tp>::PagedNode::EntrySize(const key_type& key, const mapped_type& value) noexcept
+{
+    return PageCodec<key_type>::Size(key) + PageCodec<mapped_type>::Size(value);
+}
+
+template<class Key, class Tp>
+typename PagedBPlusTree<Key, Tp>::PagedNode::size_type PagedBPlusTree<Key, Tp>::PagedNode::SeparatorSize(const key_type& key) noexcept
+{
+    return PageCodec<key_type>::Size(key) + sizeof(page_id_type);
+}
+
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::PagedNode::Recount() noexcept
+{
+    bytes_ = kHeaderSize;
+    for (size_type i = 0; i < keys_.size(); ++i)
+    {
+        bytes_ += leaf_ ? EntrySize(keys_[i], values_[i]) : SeparatorSize(keys_[i]);
+    }
+}
+
+// Value assignment merges fields, so values are shifted by move construction, as in InlineArray.
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::PagedNode::InsertValue_(std::vector<mapped_type>& values, size_type index, mapped_type value)
+{
+    if (index == values.size())
+    {
+        values.push_back(std::move(value));
+        return;
+    }
+
+    values.push_back(std::move(values.back()));
+    for (auto i = values.size() - 2; i > index; --i)
+    {
+        values[i].~mapped_type();
+        ::new (&values[i]) mapped_type(std::move(values[i - 1]));
+    }
+    values[index].~mapped_type();
+    ::new (&values[index]) mapped_type(std::move(value));
+}
+
+template<class Key, class Tp>
+void PagedBPlusTree<Key, Tp>::PagedNode::EraseValue_(std::vector<mapped_type>& values, size_type index)
+{
+    for (auto i = index; i + 1 < values.size(); ++i)
+    {
+        values[i].~mapped_type();
+        ::new (&values[i]) mapped_type(std::move(values[i + 1]));
+    }
+    values.pop_back();
+}
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_BPT_PAGED_B_PLUS_TREE_NODE_TPP_
@@ -0,0 +1,37 @@
+#ifndef TRANSACTIONS_INCLUDE_COMMON_ALLOCATION_COUNTER_H_
+#define TRANSACTIONS_INCLUDE_COMMON_ALLOCATION_COUNTER_H_
+
+#include <cstddef>
+
+namespace s21
+{
+
+/*
+Counts calls to the global operator new and the heap memory currently held
+through it. The counting operators are defined in allocation_counter.cc, so the
+numbers are only meaningful in a binary that links that file; elsewhere they
+stay at zero.
+*/
+class AllocationCounter
+{
+public:
+    using size_type = std::size_t;
+
+    struct Snapshot
+    {
+        size_type allocations{ 0 };
+        size_type bytes{ 0 };
+        // Usable size of the blocks allocated and not yet freed.
+        size_type live_bytes{ 0 };
+    };
+
+public:
+    [[nodiscard]] static Snapshot Now() noexcept;
+    static void Record(size_type bytes) noexcept;
+    static void RecordLive(void* pointer) noexcept;
+    static void ReleaseLive(void* pointer) noexcept;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_COMMON_ALLOCATION_COUNTER_H_
@@ -6,8 +6,27 @@
 #include "command_invoker.h"
 #include "wrapper/container_wrapper.h"
 #include "hash_table/hash_table.h"
+#include "hash_table/flat_hash_table.h"
+#include "hash_table/concurrent_hash_table.h"
+#include "hash_table/lock_free_read_hash_table.h"
+#include "hash_table/hashers.h"
 #include "bpt/b_plus_tree.h"
+#include "bpt/concurrent_b_plus_tree.h"
+#include "bpt/paged_b_plus_tree.h"
+#include "pool_allocator.h"
 #include "research.h"
+#include "research/storage_research.h"
+#include "research/insert_latency_research.h"
+#include "research/rehash_research.h"
+#include "research/concurrency_research.h"
+#include "research/hash_quality_research.h"
+#include "research/upload_research.h"
+#include "research/point_lookup_research.h"
+#include "research/paged_storage_research.h"
+#include "research/churn_research.h"
+#include "research/erase_cycle_research.h"
+#include "research/batch_update_research.h"
+#include "research/sorted_build_research.h"
 #include "rbtree/kvtree.h"
 
 namespace s21
@@ -23,15 +42,52 @@ private:
     using storage_type = KeyValueStorageInterface<std::string, Value>;
     using wrapper_type = ContainerWrapper<storage_type>;
     using hash_table = HashTable<std::string>;
+    using wyhash_table = HashTable<std::string, Value, WyHash>;
+    using xxh3_table = HashTable<std::string, Value, Xxh3Hash>;
+    using flat_hash_table = FlatHashTable<std::string>;
+    using concurrent_hash_table = ConcurrentHashTable<std::string>;
+    using lock_free_read_hash_table = LockFreeReadHashTable<std::string>;
     using b_plus_tree = BPlusTree<std::string>;
+    using concurrent_b_plus_tree = ConcurrentBPlusTree<std::string>;
+    using paged_b_plus_tree = PagedBPlusTree<std::string>;
     using rb_tree = SelfBalancingBinarySearchTree<std::string>;
+    using pool_rb_tree = SelfBalancingBinarySearchTree<std::string, Value, PoolAllocator<std::pair<const std::string, Value>>>;
 
 private:
     static void CleanInputStream_();
     bool MainSelector_();
     bool SelectStorageType_();
+    static storage_type* CreateHashTable_();
     bool SelectFunction_();
-    void Research_();
+    bool Research_();
+    void StorageTypesResearch_();
+    void HashTableEnginesResearch_();
+    void InsertLatencyResearch_();
+    void RehashResearch_();
+    void ConcurrencyResearch_();
+    void ReadWriteMixResearch_();
+    void HashQualityResearch_();
+    void UploadResearch_();
+    void PointLookupResearch_();
+    void NodeSearchResearch_();
+    void KeyCompressionResearch_();
+    void ConcurrentBPlusTreeResearch_();
+    void PagedBPlusTreeResearch_();
+    void ChurnResearch_();
+    void EraseCycleResearch_();
+    void BatchUpdateResearch_();
+    void SortedBuildResearch_();
+    static void PrintStorageResearch_(const std::string& name, const StorageResearch<storage_type>::Result& result);
+    static void PrintInsertLatencyResearch_(const std::string& name, const InsertLatencyResearch<storage_type>::Result& result);
+    static void PrintRehashResearch_(const std::string& name, const RehashResearch<storage_type>::Result& result);
+    static void PrintHashQualityResearch_(const std::string& name, const HashQualityResearch::Result& result);
+    static void PrintUploadResearch_(const std::string& name, const UploadResearch<wrapper_type>::Result& result);
+    static void PrintPointLookupResearch_(const std::string& name, const PointLookupResult& result);
+    static void PrintPagedStorageResearch_(const std::string& name, const PagedStorageResult& result);
+    static void PrintChurnResearch_(const std::string& name, const ChurnResult& result);
+    static void PrintEraseCycleResearch_(const std::string& name, const EraseCycleResult& result);
+    static void PrintBatchUpdateResearch_(const std::string& name, const BatchUpdateResult& result);
+    static void PrintSortedBuildResearch_(const std::string& name, const SortedBuildResult& result);
 
 private:
     std::unique_ptr<wrapper_type> storage_;
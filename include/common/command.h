@@ -305,6 +305,67 @@ public:
     }
 };
 
+template<class Container>
+class RangeCommand : public Command<Container>
+{
+public:
+    using key_type = typename Command<Container>::key_type;
+
+    explicit RangeCommand(std::istream& is)
+    {
+        is >> lower_;
+        is >> upper_;
+        if (!(is >> limit_))
+        {
+            limit_ = 0;
+        }
+    }
+
+    void Execute(Container& storage) override
+    {
+        auto entries = storage.RangeScan(lower_, upper_, limit_);
+
+        if (!entries.empty())
+        {
+            for (std::size_t i = 0; i < entries.size(); ++i)
+            {
+                std::cout << "> " << i + 1 << ") " << entries[i].first << " " << entries[i].second << std::endl;
+            }
+        }
+        else
+        {
+            std::cout << "Not a single key was found." << std::endl;
+        }
+    }
+
+private:
+    key_type lower_;
+    key_type upper_;
+    std::size_t limit_{ 0 };
+};
+
+template<class Container>
+class CountCommand : public Command<Container>
+{
+public:
+    using key_type = typename Command<Container>::key_type;
+
+    explicit CountCommand(std::istream& is)
+    {
+        is >> lower_;
+        is >> upper_;
+    }
+
+    void Execute(Container& storage) override
+    {
+        std::cout << "> " << storage.CountRange(lower_, upper_) << std::endl;
+    }
+
+private:
+    key_type lower_;
+    key_type upper_;
+};
+
 template<class Container>
 class UploadCommand : public Command<Container>
 {
@@ -63,6 +63,14 @@ public:
         {
             command_ = std::make_unique<cmd::ShowAllCommand<Container>>();
         }
+        else if (cmd == "RANGE")
+        {
+            command_ = std::make_unique<cmd::RangeCommand<Container>>(iss);
+        }
+        else if (cmd == "COUNT")
+        {
+            command_ = std::make_unique<cmd::CountCommand<Container>>(iss);
+        }
         else if (cmd == "UPLOAD")
         {
             command_ = std::make_unique<cmd::UploadCommand<Container>>(iss);
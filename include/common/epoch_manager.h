@@ -0,0 +1,93 @@
+#ifndef TRANSACTIONS_INCLUDE_COMMON_EPOCH_MANAGER_H_
+#define TRANSACTIONS_INCLUDE_COMMON_EPOCH_MANAGER_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+
+namespace s21
+{
+
+/*
+Epoch based memory reclamation for structures whose readers do not take locks.
+A reader pins the current epoch for the duration of its traversal. A writer that
+unlinks an object retires it instead of deleting it, and the object is freed only
+once the global epoch has moved two steps past the epoch it was retired in, which
+can only happen after every reader that could have seen it has unpinned.
+*/
+class EpochManager
+{
+public:
+    using size_type = std::size_t;
+    using epoch_type = std::uint64_t;
+    using deleter_type = void (*)(void*);
+
+    class Guard
+    {
+    public:
+        ~Guard();
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        friend class EpochManager;
+        Guard(EpochManager* manager, size_type slot) noexcept;
+
+    private:
+        EpochManager* manager_;
+        size_type slot_;
+    };
+
+public:
+    EpochManager();
+    ~EpochManager();
+
+    EpochManager(const EpochManager&) = delete;
+    EpochManager& operator=(const EpochManager&) = delete;
+
+    [[nodiscard]] Guard Pin();
+    void Retire(void* pointer, deleter_type deleter);
+    void Reclaim();
+
+    template<class Tp>
+    void Retire(Tp* pointer)
+    {
+        Retire(pointer, [](void* x) { delete static_cast<Tp*>(x); });
+    }
+
+private:
+    struct alignas(64) Slot
+    {
+        std::atomic<epoch_type> epoch{ kInactive };
+    };
+
+    struct Retired
+    {
+        void* pointer;
+        deleter_type deleter;
+        epoch_type epoch;
+    };
+
+    size_type Enter_();
+    void Exit_(size_type slot) noexcept;
+    bool TryAdvance_();
+    void FreeExpired_();
+
+private:
+    static constexpr epoch_type kInactive{ 0 };
+    static constexpr size_type kNumSlots{ 128 };
+    static constexpr size_type kReclaimPeriod{ 64 };
+
+    std::atomic<epoch_type> epoch_{ 1 };
+    std::unique_ptr<Slot[]> slots_;
+    std::mutex retired_mutex_;
+    std::vector<Retired> retired_;
+    size_type num_retired_since_reclaim_{ 0 };
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_COMMON_EPOCH_MANAGER_H_
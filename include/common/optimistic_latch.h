@@ -0,0 +1,79 @@
+#ifndef TRANSACTIONS_INCLUDE_COMMON_OPTIMISTIC_LATCH_H_
+#define TRANSACTIONS_INCLUDE_COMMON_OPTIMISTIC_LATCH_H_
+
+#include <atomic>
+#include <cstdint>
+
+namespace s21
+{
+
+/*
+Version latch for optimistic lock coupling. Readers do not write to the latch:
+they remember the version before reading the guarded data and check afterwards
+that it did not change, starting over if it did. A writer locks the latch by
+moving it from a version it has read to the locked state, so it also fails
+instead of waiting when someone changed the data in between. Unlocking bumps the
+version. A latch unlocked as obsolete belongs to data that was unlinked, and no
+reader or writer gets past it anymore.
+
+The lowest bit of the version marks the latch obsolete, the next one locked.
+*/
+class OptimisticLatch
+{
+public:
+    using version_type = std::uint64_t;
+
+public:
+    // Returns false if the latch is locked or obsolete.
+    bool ReadLock(version_type& version) const noexcept
+    {
+        version = version_.load(std::memory_order_acquire);
+        return (version & (kLocked | kObsolete)) == 0;
+    }
+
+    // Returns true if nothing was written since ReadLock returned the version.
+    [[nodiscard]] bool Validate(version_type version) const noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return version_.load(std::memory_order_relaxed) == version;
+    }
+
+    // Locks the latch if it is still at the version ReadLock returned.
+    bool Upgrade(version_type version) noexcept
+    {
+        if (!version_.compare_exchange_strong(version, version + kLocked, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        // A reader that sees any write made under the lock must also see the lock in Validate.
+        std::atomic_thread_fence(std::memory_order_release);
+        return true;
+    }
+
+    bool TryLock() noexcept
+    {
+        version_type version;
+        return ReadLock(version) && Upgrade(version);
+    }
+
+    void Unlock() noexcept
+    {
+        version_.fetch_add(kLocked, std::memory_order_release);
+    }
+
+    void UnlockObsolete() noexcept
+    {
+        version_.fetch_add(kLocked | kObsolete, std::memory_order_release);
+    }
+
+private:
+    static constexpr version_type kObsolete{ 1 };
+    static constexpr version_type kLocked{ 2 };
+
+    std::atomic<version_type> version_{ 0 };
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_COMMON_OPTIMISTIC_LATCH_H_
@@ -0,0 +1,120 @@
+#ifndef TRANSACTIONS_INCLUDE_COMMON_ORDERED_STORAGE_INTERFACE_H_
+#define TRANSACTIONS_INCLUDE_COMMON_ORDERED_STORAGE_INTERFACE_H_
+
+#include "storage_interface.h"
+
+namespace s21
+{
+
+/*
+Storage that keeps its keys sorted and can read a part of them in key order
+without walking the whole container.
+*/
+template<class Key, class Tp>
+class OrderedKeyValueStorageInterface : public KeyValueStorageInterface<Key, Tp>
+{
+public:
+    using key_type = typename KeyValueStorageInterface<Key, Tp>::key_type;
+    using mapped_type = typename KeyValueStorageInterface<Key, Tp>::mapped_type;
+    using size_type = typename KeyValueStorageInterface<Key, Tp>::size_type;
+    using key_view_type = typename KeyValueStorageInterface<Key, Tp>::key_view_type;
+
+    // A limit of zero means no limit.
+    static constexpr size_type kNoLimit{ 0 };
+
+public:
+    // Entries with lower <= key <= upper in key order, at most limit of them.
+    virtual std::vector<std::pair<key_type, mapped_type>> RangeScan(key_view_type lower, key_view_type upper, size_type limit) = 0;
+    // Entries whose key starts with prefix in key order, at most limit of them.
+    virtual std::vector<std::pair<key_type, mapped_type>> PrefixScan(key_view_type prefix, size_type limit) = 0;
+
+    // The order statistics below walk the entries with Scan. Containers that count
+    // the entries of their subtrees override them with logarithmic versions.
+
+    // The number of keys less than key.
+    virtual size_type Rank(key_view_type key)
+    {
+        size_type rank = 0;
+
+        ScanInOrder_([&](const auto& entry)
+        {
+            if (!(entry.first < key))
+            {
+                return false;
+            }
+            ++rank;
+            return true;
+        });
+
+        return rank;
+    }
+
+    // The entry with index keys before it.
+    virtual std::pair<key_type, mapped_type> Select(size_type index)
+    {
+        std::optional<std::pair<key_type, mapped_type>> selected;
+
+        ScanInOrder_([&](const auto& entry)
+        {
+            if (index-- == 0)
+            {
+                selected = entry;
+                return false;
+            }
+            return true;
+        });
+
+        if (!selected)
+        {
+            throw std::out_of_range("The index is out of range.");
+        }
+
+        return std::move(*selected);
+    }
+
+    // The number of keys with lower <= key <= upper.
+    virtual size_type CountRange(key_view_type lower, key_view_type upper)
+    {
+        return RangeScan(lower, upper, kNoLimit).size();
+    }
+
+protected:
+    static bool HasPrefix(const key_type& key, key_view_type prefix)
+    {
+        if constexpr (std::is_same_v<key_type, std::string>)
+        {
+            return key.compare(0, prefix.size(), prefix) == 0;
+        }
+        else
+        {
+            return key == prefix;
+        }
+    }
+
+private:
+    static constexpr size_type kScanBatch{ 256 };
+
+    // Calls visitor with the entries in key order until it returns false.
+    template<class Visitor>
+    void ScanInOrder_(Visitor visitor)
+    {
+        typename KeyValueStorageInterface<Key, Tp>::ScanCursor cursor;
+
+        do
+        {
+            auto result = this->Scan(cursor, kScanBatch);
+            for (const auto& entry : result.entries)
+            {
+                if (!visitor(entry))
+                {
+                    return;
+                }
+            }
+            cursor = std::move(result.cursor);
+        } while (!cursor.finished);
+    }
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_COMMON_ORDERED_STORAGE_INTERFACE_H_
@@ -0,0 +1,78 @@
+#ifndef TRANSACTIONS_INCLUDE_COMMON_PAGE_FILE_H_
+#define TRANSACTIONS_INCLUDE_COMMON_PAGE_FILE_H_
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <cstddef>
+#include <cstdint>
+
+namespace s21
+{
+
+/*
+A file split into pages of a fixed size, addressed by page id. Page 0 holds the
+header: the page size, the number of pages, the head of the list of freed pages
+and a few values the owner of the file keeps there, like the id of a root page.
+Freed pages are reused by Allocate before the file grows.
+
+Numbers are written in the byte order of the machine, so a file is only read
+back on the same kind of machine.
+*/
+class PageFile
+{
+public:
+    using size_type = std::size_t;
+    using page_id_type = std::uint64_t;
+
+    // Page 0 is the header, so no other page has this id.
+    static constexpr page_id_type kNoPage{ 0 };
+    static constexpr size_type kNumUserValues{ 4 };
+    static constexpr size_type kMinPageSize{ 128 };
+
+public:
+    // Opens the file if it exists and creates it otherwise.
+    PageFile(const std::filesystem::path& path, size_type page_size);
+    ~PageFile();
+
+    PageFile(const PageFile&) = delete;
+    PageFile& operator=(const PageFile&) = delete;
+
+    void Read(page_id_type id, char* data);
+    void Write(page_id_type id, const char* data);
+    page_id_type Allocate();
+    void Free(page_id_type id);
+    // Writes the header and flushes the file.
+    void Sync();
+
+    [[nodiscard]] size_type PageSize() const noexcept;
+    [[nodiscard]] size_type NumPages() const noexcept;
+    [[nodiscard]] size_type NumReads() const noexcept;
+    [[nodiscard]] size_type NumWrites() const noexcept;
+    [[nodiscard]] std::uint64_t UserValue(size_type index) const;
+    void SetUserValue(size_type index, std::uint64_t value);
+
+private:
+    struct Header
+    {
+        std::uint64_t magic{ 0 };
+        std::uint64_t page_size{ 0 };
+        std::uint64_t num_pages{ 0 };
+        page_id_type free_list{ kNoPage };
+        std::array<std::uint64_t, kNumUserValues> user_values{};
+    };
+
+    static constexpr std::uint64_t kMagic{ 0x5332315041474553 };
+
+    void Seek_(page_id_type id);
+
+private:
+    std::fstream file_;
+    Header header_;
+    size_type num_reads_{ 0 };
+    size_type num_writes_{ 0 };
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_COMMON_PAGE_FILE_H_
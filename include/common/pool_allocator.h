@@ -0,0 +1,110 @@
+#ifndef TRANSACTIONS_INCLUDE_COMMON_POOL_ALLOCATOR_H_
+#define TRANSACTIONS_INCLUDE_COMMON_POOL_ALLOCATOR_H_
+
+#include <new>
+#include <memory>
+#include <cstddef>
+#include <type_traits>
+
+#include "common/slab_arena.h"
+
+namespace s21
+{
+
+/*
+A standard allocator that takes single objects from a SlabArena sized for T and
+sends larger requests to the global allocator. Copies share the arena, so a
+container and the copies of its allocator hand out and take back the same
+blocks.
+
+It is meant for node based containers that allocate nodes of one type. An
+arena only has blocks of one size, so there is no conversion from an allocator
+for another type: a container that rebinds it, as rbTree does for its nodes,
+default constructs the rebound allocator, which gets an arena of its own.
+
+Release gives all slabs back at once without running destructors. A node based
+container calls it instead of deallocating its nodes one by one, unless
+SharesArena says another container allocates from the same arena.
+*/
+template<class T>
+class PoolAllocator
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template<class U>
+    friend class PoolAllocator;
+
+public:
+    PoolAllocator()
+        : arena_(std::make_shared<SlabArena>(sizeof(T), alignof(T)))
+    {
+    }
+
+    T* allocate(size_type n)
+    {
+        if (n == 1)
+        {
+            return static_cast<T*>(arena_->Allocate());
+        }
+
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* pointer, size_type n) noexcept
+    {
+        if (n == 1)
+        {
+            arena_->Deallocate(pointer);
+        }
+        else
+        {
+            std::allocator<T>().deallocate(pointer, n);
+        }
+    }
+
+    // A copied container starts with an arena of its own instead of sharing the one of the original.
+    [[nodiscard]] PoolAllocator select_on_container_copy_construction() const
+    {
+        return PoolAllocator();
+    }
+
+    void Release() noexcept
+    {
+        arena_->Release();
+    }
+
+    // Whether another allocator has the same arena, so Release would take its blocks too.
+    [[nodiscard]] bool SharesArena() const noexcept
+    {
+        return arena_.use_count() > 1;
+    }
+
+    [[nodiscard]] const SlabArena& Arena() const noexcept
+    {
+        return *arena_;
+    }
+
+    template<class U>
+    bool operator==(const PoolAllocator<U>& other) const noexcept
+    {
+        return static_cast<const void*>(arena_.get()) == static_cast<const void*>(other.arena_.get());
+    }
+
+    template<class U>
+    bool operator!=(const PoolAllocator<U>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+private:
+    std::shared_ptr<SlabArena> arena_;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_COMMON_POOL_ALLOCATOR_H_
@@ -0,0 +1,64 @@
+#ifndef TRANSACTIONS_INCLUDE_COMMON_SLAB_ARENA_H_
+#define TRANSACTIONS_INCLUDE_COMMON_SLAB_ARENA_H_
+
+#include <vector>
+#include <cstddef>
+
+namespace s21
+{
+
+/*
+Hands out blocks of one size and alignment, carved from slabs that each hold
+many blocks. Freed blocks go to a free list that is threaded through the blocks
+themselves and are reused first, so a structure that keeps allocating and
+freeing nodes of the same size stops calling the global allocator once it has
+enough slabs. The first slab holds a few blocks and every next one twice as
+many, up to about kMaxSlabSize bytes.
+
+Slabs are only given back all at once, by Release or the destructor, which do
+not run destructors of whatever the blocks still hold.
+*/
+class SlabArena
+{
+public:
+    using size_type = std::size_t;
+
+    static constexpr size_type kMinBlocksPerSlab{ 4 };
+    static constexpr size_type kMaxSlabSize{ 256 * 1024 };
+
+public:
+    SlabArena(size_type block_size, size_type alignment);
+    ~SlabArena();
+
+    SlabArena(const SlabArena&) = delete;
+    SlabArena& operator=(const SlabArena&) = delete;
+
+    void* Allocate();
+    void Deallocate(void* block) noexcept;
+    void Release() noexcept;
+
+    [[nodiscard]] size_type BlockSize() const noexcept;
+    [[nodiscard]] size_type NumSlabs() const noexcept;
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    void AddSlab_();
+
+private:
+    size_type block_size_{ 0 };
+    size_type alignment_;
+    size_type blocks_per_slab_{ kMinBlocksPerSlab };
+    std::vector<void*> slabs_;
+    FreeBlock* free_list_{ nullptr };
+    // The part of the newest slab that was never handed out.
+    std::byte* unused_{ nullptr };
+    std::byte* unused_end_{ nullptr };
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_COMMON_SLAB_ARENA_H_
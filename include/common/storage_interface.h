@@ -2,7 +2,13 @@
 #define TRANSACTIONS_INCLUDE_COMMON_STORAGE_INTERFACE_H_
 
 #include <filesystem>
+#include <optional>
 #include <vector>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include "storage_struct.h"
 
 namespace s21
@@ -15,14 +21,68 @@ public:
     using key_type = Key;
     using mapped_type = Tp;
     using size_type = std::size_t;
+    // Lookups take string keys as std::string_view, so callers can search
+    // straight from a parse buffer without building a std::string.
+    using key_view_type = std::conditional_t<std::is_same_v<Key, std::string>, std::string_view, const Key&>;
+
+    // Position of an incremental Scan. A default constructed cursor starts a new scan.
+    // Hash tables resume from a bucket position and remember the bucket count it was
+    // taken at, ordered containers resume after the last key they returned.
+    struct ScanCursor
+    {
+        size_type position{ 0 };
+        size_type bucket_count{ 0 };
+        std::optional<key_type> last_key{};
+        bool finished{ false };
+    };
+
+    struct ScanResult
+    {
+        std::vector<std::pair<key_type, mapped_type>> entries;
+        ScanCursor cursor;
+    };
 
 public:
     virtual ~KeyValueStorageInterface() = default;
     
-    virtual bool Insert(const key_type& key, const mapped_type& value) = 0;
-    virtual mapped_type& GetValue(const key_type& key) = 0;
-    virtual bool Erase(const key_type& key) = 0;
+    // Taken by value so that callers can move the key and the value in.
+    virtual bool Insert(key_type key, mapped_type value) = 0;
+    virtual mapped_type& GetValue(key_view_type key) = 0;
+    virtual bool Erase(key_view_type key) = 0;
     virtual std::vector<std::pair<key_type, mapped_type>> ShowAll() = 0;
+    // Returns roughly count entries from the cursor on, and the cursor to continue from.
+    // The container may be modified between calls.
+    virtual ScanResult Scan(const ScanCursor& cursor, size_type count) = 0;
+    [[nodiscard]] virtual size_type Size() const = 0;
+    virtual void Reserve([[maybe_unused]] size_type num_elements) {}
+
+    // Inserts the entries as Insert would and returns how many were inserted. Containers
+    // that can be built faster from entries sorted by key override it.
+    virtual size_type BulkLoad(std::vector<std::pair<key_type, mapped_type>> entries)
+    {
+        size_type num_inserted = 0;
+
+        for (auto& [key, value] : entries)
+        {
+            num_inserted += Insert(std::move(key), std::move(value));
+        }
+
+        return num_inserted;
+    }
+
+    virtual bool Exists(key_view_type key)
+    {
+        try
+        {
+            GetValue(key);
+        }
+        catch (const std::runtime_error& e)
+        {
+            return false;
+        }
+
+        return true;
+    }
 };
 
 } // namespace s21
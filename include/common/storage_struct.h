@@ -44,6 +44,21 @@ struct Value final
         
         return *this;
     }
+
+    // Same merge rules as the copy assignment, but the strings are moved.
+    Value& operator=(Value&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (other.last_name != "-") last_name = std::move(other.last_name);
+            if (other.first_name != "-") first_name = std::move(other.first_name);
+            birth_year = (other.birth_year != -1) ? other.birth_year : birth_year;
+            if (other.city != "-") city = std::move(other.city);
+            coins = (other.coins != -1) ? other.coins : coins;
+        }
+
+        return *this;
+    }
     
     [[nodiscard]] bool operator==(const Value& other) const
     {
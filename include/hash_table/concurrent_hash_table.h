@@ -0,0 +1,95 @@
+#ifndef TRANSACTIONS_INCLUDE_HASH_TABLE_CONCURRENT_HASH_TABLE_H_
+#define TRANSACTIONS_INCLUDE_HASH_TABLE_CONCURRENT_HASH_TABLE_H_
+
+#include <functional>
+#include <vector>
+#include <list>
+#include <memory>
+#include <atomic>
+#include <shared_mutex>
+
+#include "common/storage_interface.h"
+#include "hashers.h"
+
+namespace s21
+{
+
+/*
+Chained hash table that can be used from many threads at once. Buckets are
+guarded by a fixed set of lock stripes: bucket i belongs to stripe i % stripes,
+and the number of buckets is always a multiple of the number of stripes, so a key
+keeps its stripe across resizes. Readers take their stripe shared, writers take
+it exclusively and a resize takes every stripe.
+
+Entries never move in memory, so a reference returned by GetValue stays valid
+until the key is erased. Writing through it is not synchronised with readers.
+
+A Scan cursor is a bucket index and each call holds every stripe shared for
+its batch only. A scan that sees a resize starts over.
+*/
+template<class Key, class Tp = Value, class Hash = std::hash<Key>>
+class ConcurrentHashTable : public KeyValueStorageInterface<Key, Tp>
+{
+public:
+    using key_type = typename KeyValueStorageInterface<Key, Tp>::key_type;
+    using mapped_type = typename KeyValueStorageInterface<Key, Tp>::mapped_type;
+    using size_type = typename KeyValueStorageInterface<Key, Tp>::size_type;
+    using key_view_type = typename KeyValueStorageInterface<Key, Tp>::key_view_type;
+    using ScanCursor = typename KeyValueStorageInterface<Key, Tp>::ScanCursor;
+    using ScanResult = typename KeyValueStorageInterface<Key, Tp>::ScanResult;
+
+private:
+    struct Entry final
+    {
+        key_type key{};
+        mapped_type value{};
+        size_type hash{ 0 };
+
+        explicit Entry(key_type key, mapped_type value, size_type hash)
+            : key(std::move(key))
+            , value(std::move(value))
+            , hash(hash)
+        {}
+    };
+
+private:
+    using List = std::list<Entry>;
+    using Table = std::vector<List>;
+    using mutex_type = std::shared_mutex;
+
+public:
+    ConcurrentHashTable();
+    explicit ConcurrentHashTable(size_type num_stripes);
+
+    bool Insert(key_type key, mapped_type value) override;
+    mapped_type& GetValue(key_view_type key) override;
+    bool Exists(key_view_type key) override;
+    bool Erase(key_view_type key) override;
+    std::vector<std::pair<key_type, mapped_type>> ShowAll() override;
+    ScanResult Scan(const ScanCursor& cursor, size_type count) override;
+    [[nodiscard]] size_type Size() const override;
+    void Reserve(size_type num_elements) override;
+
+    [[nodiscard]] size_type StripeCount() const noexcept;
+
+private:
+    Entry* Find_(List& list, key_view_type key, size_type hash);
+    void Resize_(size_type table_size);
+    [[nodiscard]] mutex_type& GetStripe_(size_type hash) const noexcept;
+    [[nodiscard]] size_type GetHashValue_(key_view_type key) const;
+    [[nodiscard]] size_type GetTableIndex_(size_type hash) const noexcept;
+
+private:
+    static constexpr size_type kDefaultNumStripes{ 64 };
+
+    size_type num_stripes_;
+    std::unique_ptr<mutex_type[]> stripes_;
+    std::atomic<size_type> num_elements_{ 0 };
+    Table table_;
+};
+
+} // namespace s21
+
+#include "concurrent_hash_table.tpp"
+
+#endif // TRANSACTIONS_INCLUDE_HASH_TABLE_CONCURRENT_HASH_TABLE_H_
@@ -0,0 +1,233 @@
+#ifndef TRANSACTIONS_INCLUDE_HASH_TABLE_CONCURRENT_HASH_TABLE_TPP_
+#define TRANSACTIONS_INCLUDE_HASH_TABLE_CONCURRENT_HASH_TABLE_TPP_
+
+#include <mutex>
+#include <algorithm>
+
+namespace s21
+{
+
+template<class Key, class Tp, class Hash>
+ConcurrentHashTable<Key, Tp, Hash>::ConcurrentHashTable()
+    : ConcurrentHashTable(kDefaultNumStripes)
+{}
+
+template<class Key, class Tp, class Hash>
+ConcurrentHashTable<Key, Tp, Hash>::ConcurrentHashTable(size_type num_stripes)
+    : num_stripes_(num_stripes)
+{
+    if (num_stripes_ == 0)
+    {
+        throw std::invalid_argument("The number of lock stripes must be greater than 0.");
+    }
+
+    stripes_ = std::make_unique<mutex_type[]>(num_stripes_);
+    table_ = Table{num_stripes_};
+}
+
+template<class Key, class Tp, class Hash>
+bool ConcurrentHashTable<Key, Tp, Hash>::Insert(key_type key, mapped_type value)
+{
+    auto hash = GetHashValue_(key);
+    size_type table_size;
+
+    {
+        std::unique_lock lock(GetStripe_(hash));
+        auto& list = table_[GetTableIndex_(hash)];
+
+        if (Find_(list, key, hash))
+        {
+            return false;
+        }
+
+        list.emplace_back(std::move(key), std::move(value), hash);
+        table_size = table_.size();
+    }
+
+    if (++num_elements_ >= table_size)
+    {
+        Resize_(table_size * 2);
+    }
+
+    return true;
+}
+
+template<class Key, class Tp, class Hash>
+typename ConcurrentHashTable<Key, Tp, Hash>::mapped_type& ConcurrentHashTable<Key, Tp, Hash>::GetValue(key_view_type key)
+{
+    auto hash = GetHashValue_(key);
+
+    {
+        std::shared_lock lock(GetStripe_(hash));
+
+        if (auto entry = Find_(table_[GetTableIndex_(hash)], key, hash); entry)
+        {
+            return entry->value;
+        }
+    }
+
+    throw std::runtime_error("The value was not found.");
+}
+
+template<class Key, class Tp, class Hash>
+bool ConcurrentHashTable<Key, Tp, Hash>::Exists(key_view_type key)
+{
+    auto hash = GetHashValue_(key);
+    std::shared_lock lock(GetStripe_(hash));
+
+    return Find_(table_[GetTableIndex_(hash)], key, hash) != nullptr;
+}
+
+template<class Key, class Tp, class Hash>
+bool ConcurrentHashTable<Key, Tp, Hash>::Erase(key_view_type key)
+{
+    auto hash = GetHashValue_(key);
+    std::unique_lock lock(GetStripe_(hash));
+    auto& list = table_[GetTableIndex_(hash)];
+    auto it = std::find_if(list.begin(), list.end(), [&key, hash](auto& x)
+    {
+        return x.hash == hash && x.key == key;
+    });
+
+    if (it != list.end())
+    {
+        list.erase(it);
+        --num_elements_;
+        return true;
+    }
+
+    return false;
+}
+
+template<class Key, class Tp, class Hash>
+std::vector<std::pair<typename ConcurrentHashTable<Key, Tp, Hash>::key_type, typename ConcurrentHashTable<Key, Tp, Hash>::mapped_type>>
+ConcurrentHashTable<Key, Tp, Hash>::ShowAll()
+{
+    std::vector<std::shared_lock<mutex_type>> locks;
+    std::vector<std::pair<key_type, mapped_type>> entries;
+
+    for (size_type i = 0; i < num_stripes_; ++i)
+    {
+        locks.emplace_back(stripes_[i]);
+    }
+
+    for (const auto& list : table_)
+    {
+        for (const auto& entry : list)
+        {
+            entries.push_back({ entry.key, entry.value });
+        }
+    }
+
+    return entries;
+}
+
+template<class Key, class Tp, class Hash>
+typename ConcurrentHashTable<Key, Tp, Hash>::ScanResult
+ConcurrentHashTable<Key, Tp, Hash>::Scan(const ScanCursor& cursor, size_type count)
+{
+    std::vector<std::shared_lock<mutex_type>> locks;
+    ScanResult result;
+    auto index = cursor.bucket_count == table_.size() ? cursor.position : 0;
+
+    for (size_type i = 0; i < num_stripes_; ++i)
+    {
+        locks.emplace_back(stripes_[i]);
+    }
+
+    for (; !cursor.finished && index < table_.size() && result.entries.size() < count; ++index)
+    {
+        for (const auto& entry : table_[index])
+        {
+            result.entries.emplace_back(entry.key, entry.value);
+        }
+    }
+
+    result.cursor.position = index;
+    result.cursor.bucket_count = table_.size();
+    result.cursor.finished = cursor.finished || index >= table_.size();
+
+    return result;
+}
+
+template<class Key, class Tp, class Hash>
+typename ConcurrentHashTable<Key, Tp, Hash>::size_type ConcurrentHashTable<Key, Tp, Hash>::Size() const
+{
+    return num_elements_.load();
+}
+
+template<class Key, class Tp, class Hash>
+void ConcurrentHashTable<Key, Tp, Hash>::Reserve(size_type num_elements)
+{
+    Resize_(num_elements + 1);
+}
+
+template<class Key, class Tp, class Hash>
+typename ConcurrentHashTable<Key, Tp, Hash>::size_type ConcurrentHashTable<Key, Tp, Hash>::StripeCount() const noexcept
+{
+    return num_stripes_;
+}
+
+template<class Key, class Tp, class Hash>
+typename ConcurrentHashTable<Key, Tp, Hash>::Entry*
+ConcurrentHashTable<Key, Tp, Hash>::Find_(List& list, key_view_type key, size_type hash)
+{
+    auto it = std::find_if(list.begin(), list.end(), [&key, hash](auto& x)
+    {
+        return x.hash == hash && x.key == key;
+    });
+
+    return it != list.end() ? &(*it) : nullptr;
+}
+
+template<class Key, class Tp, class Hash>
+void ConcurrentHashTable<Key, Tp, Hash>::Resize_(size_type table_size)
+{
+    std::vector<std::unique_lock<mutex_type>> locks;
+
+    // Stripes are always taken in the same order, so concurrent resizes cannot deadlock.
+    for (size_type i = 0; i < num_stripes_; ++i)
+    {
+        locks.emplace_back(stripes_[i]);
+    }
+
+    if (table_.size() >= table_size)
+    {
+        return;
+    }
+
+    Table table((table_size + num_stripes_ - 1) / num_stripes_ * num_stripes_);
+
+    for (auto& list : table_)
+    {
+        while (!list.empty())
+        {
+            auto& new_list = table[list.front().hash % table.size()];
+            new_list.splice(new_list.end(), list, list.begin());
+        }
+    }
+
+    table_ = std::move(table);
+}
+
+template<class Key, class Tp, class Hash>
+typename ConcurrentHashTable<Key, Tp, Hash>::mutex_type& ConcurrentHashTable<Key, Tp, Hash>::GetStripe_(size_type hash) const noexcept
+{
+    return stripes_[hash % num_stripes_];
+}
+
+template<class Key, class Tp, class Hash>
+typename ConcurrentHashTable<Key, Tp, Hash>::size_type ConcurrentHashTable<Key, Tp, Hash>::GetHashValue_(key_view_type key) const
+{
+    return HashLookupKey<Key, Hash>(key);
+}
+
+template<class Key, class Tp, class Hash>
+typename ConcurrentHashTable<Key, Tp, Hash>::size_type ConcurrentHashTable<Key, Tp, Hash>::GetTableIndex_(size_type hash) const noexcept
+{
+    return hash % table_.size();
+}
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_HASH_TABLE_CONCURRENT_HASH_TABLE_TPP_
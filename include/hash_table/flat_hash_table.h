@@ -0,0 +1,122 @@
+#ifndef TRANSACTIONS_INCLUDE_HASH_TABLE_FLAT_HASH_TABLE_H_
+#define TRANSACTIONS_INCLUDE_HASH_TABLE_FLAT_HASH_TABLE_H_
+
+#include <functional>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "common/storage_interface.h"
+#include "hashers.h"
+
+namespace s21
+{
+
+/*
+Open addressing hash table. Entries live in one flat slot array and every slot
+has a control byte: empty, deleted or the low 7 bits of the entry hash. Probing
+walks aligned groups of 16 control bytes, which are matched with a single SSE2
+compare, so a lookup touches the slot array only for likely candidates.
+
+Erase never moves other entries, so a Scan cursor is a plain slot index. A
+rehash reorders every slot, so a scan that sees one starts over.
+*/
+template<class Key, class Tp = Value, class Hash = std::hash<Key>>
+class FlatHashTable : public KeyValueStorageInterface<Key, Tp>
+{
+public:
+    using key_type = typename KeyValueStorageInterface<Key, Tp>::key_type;
+    using mapped_type = typename KeyValueStorageInterface<Key, Tp>::mapped_type;
+    using size_type = typename KeyValueStorageInterface<Key, Tp>::size_type;
+    using key_view_type = typename KeyValueStorageInterface<Key, Tp>::key_view_type;
+    using ScanCursor = typename KeyValueStorageInterface<Key, Tp>::ScanCursor;
+    using ScanResult = typename KeyValueStorageInterface<Key, Tp>::ScanResult;
+
+private:
+    struct Slot final
+    {
+        key_type key{};
+        mapped_type value{};
+
+        Slot(key_type key, mapped_type value)
+            : key(std::move(key))
+            , value(std::move(value))
+        {}
+
+        Slot(Slot&& other) = default;
+    };
+
+    using ctrl_type = std::int8_t;
+    using mask_type = std::uint32_t;
+
+    static constexpr ctrl_type kEmpty{ -128 };
+    static constexpr ctrl_type kDeleted{ -2 };
+    static constexpr size_type kGroupWidth{ 16 };
+
+    class Group
+    {
+    public:
+        explicit Group(const ctrl_type* ctrl) noexcept;
+
+        [[nodiscard]] mask_type Match(ctrl_type h2) const noexcept;
+        [[nodiscard]] mask_type MatchEmpty() const noexcept;
+        [[nodiscard]] mask_type MatchEmptyOrDeleted() const noexcept;
+
+    private:
+#if defined(__SSE2__)
+        __m128i ctrl_;
+#else
+        const ctrl_type* ctrl_;
+#endif
+    };
+
+public:
+    FlatHashTable();
+    ~FlatHashTable() override;
+
+    FlatHashTable(const FlatHashTable&) = delete;
+    FlatHashTable& operator=(const FlatHashTable&) = delete;
+
+    bool Insert(key_type key, mapped_type value) override;
+    mapped_type& GetValue(key_view_type key) override;
+    bool Exists(key_view_type key) override;
+    bool Erase(key_view_type key) override;
+    std::vector<std::pair<key_type, mapped_type>> ShowAll() override;
+    ScanResult Scan(const ScanCursor& cursor, size_type count) override;
+    [[nodiscard]] size_type Size() const override;
+    void Reserve(size_type num_elements) override;
+
+    [[nodiscard]] size_type Capacity() const noexcept;
+
+private:
+    Slot* Find_(key_view_type key);
+    size_type FindInsertPosition_(size_type hash) const noexcept;
+    void SetCtrl_(size_type index, ctrl_type value) noexcept;
+    void Rehash_(size_type num_groups);
+    void Allocate_(size_type num_groups);
+    void Deallocate_();
+    [[nodiscard]] size_type GetHashValue_(key_view_type key) const;
+    [[nodiscard]] static size_type H1_(size_type hash) noexcept;
+    [[nodiscard]] static ctrl_type H2_(size_type hash) noexcept;
+    [[nodiscard]] static bool IsFull_(ctrl_type ctrl) noexcept;
+    [[nodiscard]] static size_type CountTrailingZeros_(mask_type mask) noexcept;
+    [[nodiscard]] static size_type MaxLoad_(size_type capacity) noexcept;
+
+private:
+    std::unique_ptr<ctrl_type[]> ctrl_;
+    Slot* slots_{ nullptr };
+    std::allocator<Slot> allocator_;
+    size_type num_groups_{ 0 };
+    size_type num_elements_{ 0 };
+    size_type growth_left_{ 0 };
+};
+
+} // namespace s21
+
+#include "flat_hash_table.tpp"
+
+#endif // TRANSACTIONS_INCLUDE_HASH_TABLE_FLAT_HASH_TABLE_H_
@@ -0,0 +1,363 @@
+#ifndef TRANSACTIONS_INCLUDE_HASH_TABLE_FLAT_HASH_TABLE_TPP_
+#define TRANSACTIONS_INCLUDE_HASH_TABLE_FLAT_HASH_TABLE_TPP_
+
+#include <cstring>
+
+namespace s21
+{
+
+template<class Key, class Tp, class Hash>
+FlatHashTable<Key, Tp, Hash>::Group::Group(const ctrl_type* ctrl) noexcept
+#if defined(__SSE2__)
+    : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+#else
+    : ctrl_(ctrl)
+#endif
+{}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::mask_type FlatHashTable<Key, Tp, Hash>::Group::Match(ctrl_type h2) const noexcept
+{
+#if defined(__SSE2__)
+    return static_cast<mask_type>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(h2))));
+#else
+    mask_type mask = 0;
+    for (size_type i = 0; i < kGroupWidth; ++i)
+    {
+        mask |= static_cast<mask_type>(ctrl_[i] == h2) << i;
+    }
+    return mask;
+#endif
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::mask_type FlatHashTable<Key, Tp, Hash>::Group::MatchEmpty() const noexcept
+{
+    return Match(kEmpty);
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::mask_type FlatHashTable<Key, Tp, Hash>::Group::MatchEmptyOrDeleted() const noexcept
+{
+#if defined(__SSE2__)
+    return static_cast<mask_type>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl_)));
+#else
+    mask_type mask = 0;
+    for (size_type i = 0; i < kGroupWidth; ++i)
+    {
+        mask |= static_cast<mask_type>(ctrl_[i] < -1) << i;
+    }
+    return mask;
+#endif
+}
+
+template<class Key, class Tp, class Hash>
+FlatHashTable<Key, Tp, Hash>::FlatHashTable()
+{
+    Allocate_(1);
+}
+
+template<class Key, class Tp, class Hash>
+FlatHashTable<Key, Tp, Hash>::~FlatHashTable()
+{
+    Deallocate_();
+}
+
+template<class Key, class Tp, class Hash>
+bool FlatHashTable<Key, Tp, Hash>::Insert(key_type key, mapped_type value)
+{
+    if (Find_(key))
+    {
+        return false;
+    }
+
+    if (growth_left_ == 0)
+    {
+        Rehash_(num_elements_ * 2 < MaxLoad_(Capacity()) ? num_groups_ : num_groups_ * 2);
+    }
+
+    auto hash = GetHashValue_(key);
+    auto index = FindInsertPosition_(hash);
+
+    std::allocator_traits<std::allocator<Slot>>::construct(allocator_, slots_ + index, std::move(key), std::move(value));
+    if (ctrl_[index] == kEmpty)
+    {
+        --growth_left_;
+    }
+    SetCtrl_(index, H2_(hash));
+    ++num_elements_;
+
+    return true;
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::mapped_type& FlatHashTable<Key, Tp, Hash>::GetValue(key_view_type key)
+{
+    if (auto slot = Find_(key); slot)
+    {
+        return slot->value;
+    }
+
+    throw std::runtime_error("The value was not found.");
+}
+
+template<class Key, class Tp, class Hash>
+bool FlatHashTable<Key, Tp, Hash>::Exists(key_view_type key)
+{
+    return Find_(key) != nullptr;
+}
+
+template<class Key, class Tp, class Hash>
+bool FlatHashTable<Key, Tp, Hash>::Erase(key_view_type key)
+{
+    auto slot = Find_(key);
+
+    if (!slot)
+    {
+        return false;
+    }
+
+    auto index = static_cast<size_type>(slot - slots_);
+    std::allocator_traits<std::allocator<Slot>>::destroy(allocator_, slot);
+    --num_elements_;
+
+    // Probing stops at the first group with an empty slot, so if this group already has
+    // one no probe sequence can run through it and the slot may become empty again.
+    if (Group(ctrl_.get() + index - index % kGroupWidth).MatchEmpty())
+    {
+        SetCtrl_(index, kEmpty);
+        ++growth_left_;
+    }
+    else
+    {
+        SetCtrl_(index, kDeleted);
+    }
+
+    return true;
+}
+
+template<class Key, class Tp, class Hash>
+std::vector<std::pair<typename FlatHashTable<Key, Tp, Hash>::key_type, typename FlatHashTable<Key, Tp, Hash>::mapped_type>>
+FlatHashTable<Key, Tp, Hash>::ShowAll()
+{
+    std::vector<std::pair<key_type, mapped_type>> entries;
+    entries.reserve(num_elements_);
+
+    for (size_type i = 0; i < Capacity(); ++i)
+    {
+        if (IsFull_(ctrl_[i]))
+        {
+            entries.push_back({ slots_[i].key, slots_[i].value });
+        }
+    }
+
+    return entries;
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::ScanResult FlatHashTable<Key, Tp, Hash>::Scan(const ScanCursor& cursor, size_type count)
+{
+    ScanResult result;
+    auto index = cursor.bucket_count == Capacity() ? cursor.position : 0;
+
+    for (; !cursor.finished && index < Capacity() && result.entries.size() < count; ++index)
+    {
+        if (IsFull_(ctrl_[index]))
+        {
+            result.entries.emplace_back(slots_[index].key, slots_[index].value);
+        }
+    }
+
+    result.cursor.position = index;
+    result.cursor.bucket_count = Capacity();
+    result.cursor.finished = cursor.finished || index >= Capacity();
+
+    return result;
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::size_type FlatHashTable<Key, Tp, Hash>::Size() const
+{
+    return num_elements_;
+}
+
+template<class Key, class Tp, class Hash>
+void FlatHashTable<Key, Tp, Hash>::Reserve(size_type num_elements)
+{
+    auto num_groups = num_groups_;
+
+    while (MaxLoad_(num_groups * kGroupWidth) < num_elements)
+    {
+        num_groups *= 2;
+    }
+
+    if (num_groups != num_groups_)
+    {
+        Rehash_(num_groups);
+    }
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::size_type FlatHashTable<Key, Tp, Hash>::Capacity() const noexcept
+{
+    return num_groups_ * kGroupWidth;
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::Slot* FlatHashTable<Key, Tp, Hash>::Find_(key_view_type key)
+{
+    auto hash = GetHashValue_(key);
+    auto h2 = H2_(hash);
+    auto group_mask = num_groups_ - 1;
+    auto group_index = H1_(hash) & group_mask;
+
+    for (size_type step = 1; step <= num_groups_; ++step)
+    {
+        auto offset = group_index * kGroupWidth;
+        Group group(ctrl_.get() + offset);
+
+        for (auto mask = group.Match(h2); mask; mask &= mask - 1)
+        {
+            auto index = offset + CountTrailingZeros_(mask);
+            if (slots_[index].key == key)
+            {
+                return slots_ + index;
+            }
+        }
+
+        if (group.MatchEmpty())
+        {
+            return nullptr;
+        }
+
+        group_index = (group_index + step) & group_mask;
+    }
+
+    return nullptr;
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::size_type FlatHashTable<Key, Tp, Hash>::FindInsertPosition_(size_type hash) const noexcept
+{
+    auto group_mask = num_groups_ - 1;
+    auto group_index = H1_(hash) & group_mask;
+
+    for (size_type step = 1; ; ++step)
+    {
+        auto offset = group_index * kGroupWidth;
+
+        if (auto mask = Group(ctrl_.get() + offset).MatchEmptyOrDeleted(); mask)
+        {
+            return offset + CountTrailingZeros_(mask);
+        }
+
+        group_index = (group_index + step) & group_mask;
+    }
+}
+
+template<class Key, class Tp, class Hash>
+void FlatHashTable<Key, Tp, Hash>::SetCtrl_(size_type index, ctrl_type value) noexcept
+{
+    ctrl_[index] = value;
+}
+
+template<class Key, class Tp, class Hash>
+void FlatHashTable<Key, Tp, Hash>::Rehash_(size_type num_groups)
+{
+    auto old_ctrl = std::move(ctrl_);
+    auto old_slots = slots_;
+    auto old_capacity = Capacity();
+
+    Allocate_(num_groups);
+
+    for (size_type i = 0; i < old_capacity; ++i)
+    {
+        if (IsFull_(old_ctrl[i]))
+        {
+            auto hash = GetHashValue_(old_slots[i].key);
+            auto index = FindInsertPosition_(hash);
+
+            std::allocator_traits<std::allocator<Slot>>::construct(allocator_, slots_ + index, std::move(old_slots[i]));
+            std::allocator_traits<std::allocator<Slot>>::destroy(allocator_, old_slots + i);
+            SetCtrl_(index, H2_(hash));
+            ++num_elements_;
+            --growth_left_;
+        }
+    }
+
+    allocator_.deallocate(old_slots, old_capacity);
+}
+
+template<class Key, class Tp, class Hash>
+void FlatHashTable<Key, Tp, Hash>::Allocate_(size_type num_groups)
+{
+    auto capacity = num_groups * kGroupWidth;
+
+    ctrl_ = std::make_unique<ctrl_type[]>(capacity);
+    std::memset(ctrl_.get(), static_cast<unsigned char>(kEmpty), capacity);
+    slots_ = allocator_.allocate(capacity);
+    num_groups_ = num_groups;
+    num_elements_ = 0;
+    growth_left_ = MaxLoad_(capacity);
+}
+
+template<class Key, class Tp, class Hash>
+void FlatHashTable<Key, Tp, Hash>::Deallocate_()
+{
+    if (!slots_)
+    {
+        return;
+    }
+
+    for (size_type i = 0; i < Capacity(); ++i)
+    {
+        if (IsFull_(ctrl_[i]))
+        {
+            std::allocator_traits<std::allocator<Slot>>::destroy(allocator_, slots_ + i);
+        }
+    }
+
+    allocator_.deallocate(slots_, Capacity());
+    slots_ = nullptr;
+    ctrl_.reset();
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::size_type FlatHashTable<Key, Tp, Hash>::GetHashValue_(key_view_type key) const
+{
+    return HashLookupKey<Key, Hash>(key);
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::size_type FlatHashTable<Key, Tp, Hash>::H1_(size_type hash) noexcept
+{
+    return hash >> 7;
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::ctrl_type FlatHashTable<Key, Tp, Hash>::H2_(size_type hash) noexcept
+{
+    return static_cast<ctrl_type>(hash & 0x7F);
+}
+
+template<class Key, class Tp, class Hash>
+bool FlatHashTable<Key, Tp, Hash>::IsFull_(ctrl_type ctrl) noexcept
+{
+    return ctrl >= 0;
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::size_type FlatHashTable<Key, Tp, Hash>::CountTrailingZeros_(mask_type mask) noexcept
+{
+    return static_cast<size_type>(__builtin_ctz(mask));
+}
+
+template<class Key, class Tp, class Hash>
+typename FlatHashTable<Key, Tp, Hash>::size_type FlatHashTable<Key, Tp, Hash>::MaxLoad_(size_type capacity) noexcept
+{
+    return capacity - capacity / 8;
+}
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_HASH_TABLE_FLAT_HASH_TABLE_TPP_
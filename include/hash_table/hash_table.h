@@ -9,11 +9,30 @@
 #include <sstream>
 
 #include "common/storage_interface.h"
+#include "hashers.h"
 #include "common/timer.h"
 
 namespace s21
 {
 
+// kIncremental keeps the previous table alive after a resize and moves a few of its
+// buckets on every operation, so no single insert has to move the whole table.
+enum class RehashPolicy
+{
+    kImmediate,
+    kIncremental,
+};
+
+/*
+Separate chaining hash table. The number of buckets is always a power of two, so
+a bucket is selected by masking the low bits of the hash. Hash may be any
+functor, including the string hashers from hashers.h.
+
+Scan walks the buckets of the new table in order, each together with the buckets
+of the old table that migrate into it. Growing only splits buckets forward, so a
+scan continues across it; after a shrink it starts over. Either way an entry
+present for the whole scan is returned at least once, possibly twice.
+*/
 template<class Key, class Tp = Value, class Hash = std::hash<Key>>
 class HashTable : public KeyValueStorageInterface<Key, Tp>
 {
@@ -21,16 +40,21 @@ public:
     using key_type = typename KeyValueStorageInterface<Key, Tp>::key_type;
     using mapped_type = typename KeyValueStorageInterface<Key, Tp>::mapped_type;
     using size_type = typename KeyValueStorageInterface<Key, Tp>::size_type;
+    using key_view_type = typename KeyValueStorageInterface<Key, Tp>::key_view_type;
+    using ScanCursor = typename KeyValueStorageInterface<Key, Tp>::ScanCursor;
+    using ScanResult = typename KeyValueStorageInterface<Key, Tp>::ScanResult;
 
 private:
     struct Entry final
     {
         key_type key{};
         mapped_type value{};
+        size_type hash{ 0 };
 
-        explicit Entry(key_type key, mapped_type value)
-            : key(key)
-            , value(value)
+        explicit Entry(key_type key, mapped_type value, size_type hash)
+            : key(std::move(key))
+            , value(std::move(value))
+            , hash(hash)
         {}
     };
 
@@ -40,22 +64,51 @@ private:
 
 public:
     HashTable() = default;
+    explicit HashTable(RehashPolicy policy);
 
-    bool Insert(const key_type& key, const mapped_type& value) override;
-    mapped_type& GetValue(const key_type& key) override;
-    bool Erase(const key_type& key) override;
+    bool Insert(key_type key, mapped_type value) override;
+    mapped_type& GetValue(key_view_type key) override;
+    bool Exists(key_view_type key) override;
+    bool Erase(key_view_type key) override;
     std::vector<std::pair<key_type, mapped_type>> ShowAll() override;
+    ScanResult Scan(const ScanCursor& cursor, size_type count) override;
+    [[nodiscard]] size_type Size() const override;
+    void Reserve(size_type num_elements) override;
+
+    [[nodiscard]] size_type BucketCount() const noexcept;
+    [[nodiscard]] size_type BucketSize(size_type index) const;
+    [[nodiscard]] float MaxLoadFactor() const noexcept;
+    void SetMaxLoadFactor(float max_load_factor);
 
 private:
-    Entry* Find_(const key_type& key);
-    void Rehash_();
-    [[nodiscard]] size_type GetHashValue_(const key_type& value) const;
-    [[nodiscard]] size_type GetNewTableIndex_(const key_type& value) const;
+    Entry* Find_(key_view_type key);
+    std::pair<List*, typename List::iterator> FindInBucket_(key_view_type key, size_type hash);
+    void Rehash_(size_type table_size);
+    void MoveBucket_(List& list);
+    void MigrateStep_();
+    void CompleteMigration_();
+    [[nodiscard]] bool IsMigrating_() const noexcept;
+    void ScanBucket_(size_type index, std::vector<std::pair<key_type, mapped_type>>& entries) const;
+    [[nodiscard]] size_type GetHashValue_(key_view_type value) const;
+    [[nodiscard]] size_type GetNewTableIndex_(size_type hash) const noexcept;
+    [[nodiscard]] size_type GetOldTableIndex_(size_type hash) const noexcept;
+    [[nodiscard]] static size_type RoundUpToPowerOfTwo_(size_type value) noexcept;
 
 private:
-    size_type table_size_{ 10 };
+    static constexpr size_type kMigrationStep{ 8 };
+    static constexpr size_type kMinTableSize{ 16 };
+    static constexpr float kShrinkRatio{ 0.25f };
+    static constexpr size_type kScanEmptyVisits{ 10 };
+
+    RehashPolicy rehash_policy_{ RehashPolicy::kImmediate };
+    float max_load_factor_{ 1.0f };
+    size_type table_size_{ kMinTableSize };
+    // The table does not shrink below this, raised by Reserve.
+    size_type min_table_size_{ kMinTableSize };
     size_type num_elements_{ 0 };
-    Table table_{ 10 };
+    Table table_{ kMinTableSize };
+    Table old_table_;
+    size_type migrate_index_{ 0 };
 };
 
 } // namespace s21
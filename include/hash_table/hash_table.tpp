@@ -1,21 +1,31 @@
 #ifndef TRANSACTIONS_INCLUDE_HASH_TABLE_HASH_TABLE_TPP_
 #define TRANSACTIONS_INCLUDE_HASH_TABLE_HASH_TABLE_TPP_
 
+#include <cmath>
+
 namespace s21
 {
 
 template<class Key, class Tp, class Hash>
-bool HashTable<Key, Tp, Hash>::Insert(const key_type& key, const mapped_type& value)
+HashTable<Key, Tp, Hash>::HashTable(RehashPolicy policy)
+    : rehash_policy_(policy)
+{}
+
+template<class Key, class Tp, class Hash>
+bool HashTable<Key, Tp, Hash>::Insert(key_type key, mapped_type value)
 {
-    if (!Find_(key))
+    MigrateStep_();
+
+    auto hash = GetHashValue_(key);
+    if (!FindInBucket_(key, hash).first)
     {
-        table_[GetNewTableIndex_(key)].emplace_back(key, value);
+        table_[GetNewTableIndex_(hash)].emplace_back(std::move(key), std::move(value), hash);
         ++num_elements_;
-        if (num_elements_ == table_size_)
+        if (num_elements_ >= table_size_ * max_load_factor_)
         {
-            Rehash_();
+            Rehash_(table_size_ * 2);
         }
-        
+
         return true;
     }
 
@@ -23,8 +33,10 @@ bool HashTable<Key, Tp, Hash>::Insert(const key_type& key, const mapped_type& va
 }
 
 template<class Key, class Tp, class Hash>
-typename HashTable<Key, Tp, Hash>::mapped_type& HashTable<Key, Tp, Hash>::GetValue(const key_type& key)
+typename HashTable<Key, Tp, Hash>::mapped_type& HashTable<Key, Tp, Hash>::GetValue(key_view_type key)
 {
+    MigrateStep_();
+
     if (auto entry = Find_(key); entry)
     {
         return entry->value;
@@ -34,18 +46,25 @@ typename HashTable<Key, Tp, Hash>::mapped_type& HashTable<Key, Tp, Hash>::GetVal
 }
 
 template<class Key, class Tp, class Hash>
-bool HashTable<Key, Tp, Hash>::Erase(const key_type& key)
+bool HashTable<Key, Tp, Hash>::Exists(key_view_type key)
 {
-    auto& list = table_[GetNewTableIndex_(key)];
-    auto it = std::find_if(list.begin(), list.end(), [&key](auto& x)
-    {
-        return x.key == key;
-    });
+    MigrateStep_();
+    return Find_(key) != nullptr;
+}
 
-    if (it != list.end())
+template<class Key, class Tp, class Hash>
+bool HashTable<Key, Tp, Hash>::Erase(key_view_type key)
+{
+    MigrateStep_();
+
+    if (auto [list, it] = FindInBucket_(key, GetHashValue_(key)); list)
     {
-        table_[GetNewTableIndex_(key)].erase(it);
+        list->erase(it);
         --num_elements_;
+        if (table_size_ > min_table_size_ && num_elements_ < table_size_ * max_load_factor_ * kShrinkRatio)
+        {
+            Rehash_(std::max(table_size_ / 2, min_table_size_));
+        }
         return true;
     }
 
@@ -57,11 +76,14 @@ std::vector<std::pair<typename HashTable<Key, Tp, Hash>::key_type, typename Hash
 {
     std::vector<std::pair<key_type, mapped_type>> entries;
 
-    for (const auto& list : table_)
+    for (const auto* table : { &table_, &old_table_ })
     {
-        for (const auto& entry : list)
+        for (const auto& list : *table)
         {
-            entries.push_back({ entry.key, entry.value });
+            for (const auto& entry : list)
+            {
+                entries.push_back({ entry.key, entry.value });
+            }
         }
     }
 
@@ -69,15 +91,85 @@ std::vector<std::pair<typename HashTable<Key, Tp, Hash>::key_type, typename Hash
 }
 
 template<class Key, class Tp, class Hash>
-typename HashTable<Key, Tp, Hash>::Entry* HashTable<Key, Tp, Hash>::Find_(const key_type& key)
+typename HashTable<Key, Tp, Hash>::ScanResult HashTable<Key, Tp, Hash>::Scan(const ScanCursor& cursor, size_type count)
 {
-    auto& list = table_[GetNewTableIndex_(key)];
-    auto it = std::find_if(list.begin(), list.end(), [&key](auto& x)
+    ScanResult result;
+    // A cursor from before a shrink starts over, one from before a growth goes on.
+    auto bucket_count = table_size_;
+    auto index = cursor.bucket_count > bucket_count ? 0 : cursor.position;
+
+    // Like Redis, a sparse table does not make one call walk every empty bucket.
+    auto max_visits = std::max(count, size_type{ 1 }) * kScanEmptyVisits;
+
+    for (size_type visits = 0; !cursor.finished && index < bucket_count && visits < max_visits && result.entries.size() < count; ++index, ++visits)
     {
-        return x.key == key;
-    });
+        ScanBucket_(index, result.entries);
+    }
+
+    result.cursor.position = index;
+    result.cursor.bucket_count = bucket_count;
+    result.cursor.finished = cursor.finished || index >= bucket_count;
+
+    return result;
+}
+
+template<class Key, class Tp, class Hash>
+typename HashTable<Key, Tp, Hash>::size_type HashTable<Key, Tp, Hash>::Size() const
+{
+    return num_elements_;
+}
 
-    if (it != list.end())
+template<class Key, class Tp, class Hash>
+void HashTable<Key, Tp, Hash>::Reserve(size_type num_elements)
+{
+    auto table_size = RoundUpToPowerOfTwo_(static_cast<size_type>(std::ceil(num_elements / max_load_factor_)) + 1);
+
+    // Erasing does not shrink the table below a reservation.
+    min_table_size_ = std::max(min_table_size_, table_size);
+    if (table_size > table_size_)
+    {
+        Rehash_(table_size);
+        CompleteMigration_();
+    }
+}
+
+template<class Key, class Tp, class Hash>
+typename HashTable<Key, Tp, Hash>::size_type HashTable<Key, Tp, Hash>::BucketCount() const noexcept
+{
+    return table_size_;
+}
+
+template<class Key, class Tp, class Hash>
+typename HashTable<Key, Tp, Hash>::size_type HashTable<Key, Tp, Hash>::BucketSize(size_type index) const
+{
+    return table_.at(index).size();
+}
+
+template<class Key, class Tp, class Hash>
+float HashTable<Key, Tp, Hash>::MaxLoadFactor() const noexcept
+{
+    return max_load_factor_;
+}
+
+template<class Key, class Tp, class Hash>
+void HashTable<Key, Tp, Hash>::SetMaxLoadFactor(float max_load_factor)
+{
+    if (!(max_load_factor > 0))
+    {
+        throw std::invalid_argument("The maximum load factor must be greater than 0.");
+    }
+
+    max_load_factor_ = max_load_factor;
+    if (num_elements_ >= table_size_ * max_load_factor_)
+    {
+        Rehash_(static_cast<size_type>(std::ceil(num_elements_ / max_load_factor_)) + 1);
+    }
+}
+
+template<class Key, class Tp, class Hash>
+typename HashTable<Key, Tp, Hash>::Entry* HashTable<Key, Tp, Hash>::Find_(key_view_type key)
+{
+    if (auto [list, it] = FindInBucket_(key, GetHashValue_(key)); list)
     {
         return &(*it);
     }
@@ -86,32 +178,151 @@ typename HashTable<Key, Tp, Hash>::Entry* HashTable<Key, Tp, Hash>::Find_(const
 }
 
 template<class Key, class Tp, class Hash>
-void HashTable<Key, Tp, Hash>::Rehash_()
+std::pair<typename HashTable<Key, Tp, Hash>::List*, typename HashTable<Key, Tp, Hash>::List::iterator>
+HashTable<Key, Tp, Hash>::FindInBucket_(key_view_type key, size_type hash)
 {
-    table_size_ *= 2;
-    num_elements_ = 0;
-    auto old_table = std::move(table_);
+    static const auto FindInList = [](List& list, key_view_type key, size_type hash)
+    {
+        return std::find_if(list.begin(), list.end(), [&key, hash](auto& x)
+        {
+            return x.hash == hash && x.key == key;
+        });
+    };
+
+    auto& list = table_[GetNewTableIndex_(hash)];
+    if (auto it = FindInList(list, key, hash); it != list.end())
+    {
+        return { &list, it };
+    }
+
+    if (IsMigrating_())
+    {
+        auto& old_list = old_table_[GetOldTableIndex_(hash)];
+        if (auto it = FindInList(old_list, key, hash); it != old_list.end())
+        {
+            return { &old_list, it };
+        }
+    }
+
+    return { nullptr, {} };
+}
+
+template<class Key, class Tp, class Hash>
+void HashTable<Key, Tp, Hash>::Rehash_(size_type table_size)
+{
+    if (IsMigrating_())
+    {
+        CompleteMigration_();
+    }
+
+    table_size_ = RoundUpToPowerOfTwo_(table_size);
+    old_table_ = std::move(table_);
     table_ = Table{table_size_};
+    migrate_index_ = 0;
+
+    if (rehash_policy_ == RehashPolicy::kImmediate)
+    {
+        CompleteMigration_();
+    }
+}
+
+template<class Key, class Tp, class Hash>
+void HashTable<Key, Tp, Hash>::MoveBucket_(List& list)
+{
+    while (!list.empty())
+    {
+        auto& new_list = table_[GetNewTableIndex_(list.front().hash)];
+        new_list.splice(new_list.end(), list, list.begin());
+    }
+}
+
+template<class Key, class Tp, class Hash>
+void HashTable<Key, Tp, Hash>::MigrateStep_()
+{
+    if (!IsMigrating_())
+    {
+        return;
+    }
+
+    for (size_type i = 0; i < kMigrationStep && migrate_index_ < old_table_.size(); ++i, ++migrate_index_)
+    {
+        MoveBucket_(old_table_[migrate_index_]);
+    }
+
+    if (migrate_index_ == old_table_.size())
+    {
+        old_table_ = Table{};
+        migrate_index_ = 0;
+    }
+}
+
+template<class Key, class Tp, class Hash>
+void HashTable<Key, Tp, Hash>::CompleteMigration_()
+{
+    for (; migrate_index_ < old_table_.size(); ++migrate_index_)
+    {
+        MoveBucket_(old_table_[migrate_index_]);
+    }
 
-    for (const auto& list : old_table)
+    old_table_ = Table{};
+    migrate_index_ = 0;
+}
+
+template<class Key, class Tp, class Hash>
+bool HashTable<Key, Tp, Hash>::IsMigrating_() const noexcept
+{
+    return !old_table_.empty();
+}
+
+template<class Key, class Tp, class Hash>
+void HashTable<Key, Tp, Hash>::ScanBucket_(size_type index, std::vector<std::pair<key_type, mapped_type>>& entries) const
+{
+    static const auto CopyList = [](const List& list, std::vector<std::pair<key_type, mapped_type>>& entries)
     {
         for (const auto& entry : list)
         {
-            Insert(entry.key, entry.value);
+            entries.emplace_back(entry.key, entry.value);
         }
+    };
+
+    // Along with the bucket go the buckets of the old table that migrate into it, so a
+    // migration does not move entries from ahead of the cursor to behind it.
+    CopyList(table_[index], entries);
+    for (auto old_index = index; old_index < old_table_.size(); old_index += table_.size())
+    {
+        CopyList(old_table_[old_index], entries);
     }
 }
 
 template<class Key, class Tp, class Hash>
-typename HashTable<Key, Tp, Hash>::size_type HashTable<Key, Tp, Hash>::GetHashValue_(const key_type& value) const
+typename HashTable<Key, Tp, Hash>::size_type HashTable<Key, Tp, Hash>::GetHashValue_(key_view_type value) const
+{
+    return HashLookupKey<Key, Hash>(value);
+}
+
+template<class Key, class Tp, class Hash>
+typename HashTable<Key, Tp, Hash>::size_type HashTable<Key, Tp, Hash>::GetNewTableIndex_(size_type hash) const noexcept
 {
-    return Hash{}(value);
+    return hash & (table_size_ - 1);
 }
 
 template<class Key, class Tp, class Hash>
-typename HashTable<Key, Tp, Hash>::size_type HashTable<Key, Tp, Hash>::GetNewTableIndex_(const key_type& value) const
+typename HashTable<Key, Tp, Hash>::size_type HashTable<Key, Tp, Hash>::GetOldTableIndex_(size_type hash) const noexcept
 {
-    return GetHashValue_(value) % table_size_;
+    return hash & (old_table_.size() - 1);
+}
+
+template<class Key, class Tp, class Hash>
+typename HashTable<Key, Tp, Hash>::size_type HashTable<Key, Tp, Hash>::RoundUpToPowerOfTwo_(size_type value) noexcept
+{
+    size_type result = 1;
+
+    while (result < value)
+    {
+        result <<= 1;
+    }
+
+    return result;
 }
 
 } // namespace s21
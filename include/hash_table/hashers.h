@@ -0,0 +1,258 @@
+#ifndef TRANSACTIONS_INCLUDE_HASH_TABLE_HASHERS_H_
+#define TRANSACTIONS_INCLUDE_HASH_TABLE_HASHERS_H_
+
+#include <string>
+#include <string_view>
+#include <functional>
+#include <type_traits>
+#include <cstdint>
+#include <cstring>
+#include <array>
+
+namespace s21
+{
+
+namespace hashers_detail
+{
+
+using u64 = std::uint64_t;
+
+inline u64 Read8(const char* p) noexcept
+{
+    u64 value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline u64 Read4(const char* p) noexcept
+{
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline u64 Rotl(u64 x, int r) noexcept
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+// Full 64x64 -> 128 bit multiply, returned as the low and high halves.
+inline void Multiply128(u64& lo, u64& hi) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ using u128 = unsigned __int128;
+    u128 r = static_cast<u128>(lo) * hi;
+    lo = static_cast<u64>(r);
+    hi = static_cast<u64>(r >> 64);
+#else
+    u64 ha = lo >> 32, hb = hi >> 32, la = static_cast<std::uint32_t>(lo), lb = static_cast<std::uint32_t>(hi);
+    u64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    u64 t = rl + (rm0 << 32);
+    u64 carry = t < rl;
+    lo = t + (rm1 << 32);
+    carry += lo < t;
+    hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+inline u64 MultiplyFold(u64 a, u64 b) noexcept
+{
+    Multiply128(a, b);
+    return a ^ b;
+}
+
+constexpr u64 SplitMix64(u64 x) noexcept
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+constexpr std::array<u64, 16> MakeSecret() noexcept
+{
+    std::array<u64, 16> secret{};
+    for (std::size_t i = 0; i < secret.size(); ++i)
+    {
+        secret[i] = SplitMix64(i + 1);
+    }
+    return secret;
+}
+
+} // namespace hashers_detail
+
+/*
+wyhash (final version): reads the input 16 or 48 bytes at a time and mixes every
+block with a folded 128 bit multiply. Very fast on short and medium keys.
+*/
+struct WyHash
+{
+    std::size_t operator()(std::string_view key) const noexcept
+    {
+        using namespace hashers_detail;
+        static constexpr u64 kSecret[4] = {
+                0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL };
+
+        auto p = key.data();
+        auto len = static_cast<u64>(key.size());
+        u64 seed = MultiplyFold(kSecret[0], kSecret[1]);
+        u64 a = 0;
+        u64 b = 0;
+
+        if (len <= 16)
+        {
+            if (len >= 4)
+            {
+                auto offset = (len >> 3) << 2;
+                a = (Read4(p) << 32) | Read4(p + offset);
+                b = (Read4(p + len - 4) << 32) | Read4(p + len - 4 - offset);
+            }
+            else if (len > 0)
+            {
+                a = (static_cast<u64>(static_cast<unsigned char>(p[0])) << 16)
+                    | (static_cast<u64>(static_cast<unsigned char>(p[len >> 1])) << 8)
+                    | static_cast<unsigned char>(p[len - 1]);
+            }
+        }
+        else
+        {
+            auto i = len;
+            if (i > 48)
+            {
+                auto see1 = seed;
+                auto see2 = seed;
+                do
+                {
+                    seed = MultiplyFold(Read8(p) ^ kSecret[1], Read8(p + 8) ^ seed);
+                    see1 = MultiplyFold(Read8(p + 16) ^ kSecret[2], Read8(p + 24) ^ see1);
+                    see2 = MultiplyFold(Read8(p + 32) ^ kSecret[3], Read8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= see1 ^ see2;
+            }
+            while (i > 16)
+            {
+                seed = MultiplyFold(Read8(p) ^ kSecret[1], Read8(p + 8) ^ seed);
+                p += 16;
+                i -= 16;
+            }
+            a = Read8(p + i - 16);
+            b = Read8(p + i - 8);
+        }
+
+        a ^= kSecret[1];
+        b ^= seed;
+        Multiply128(a, b);
+        return static_cast<std::size_t>(MultiplyFold(a ^ kSecret[0] ^ len, b ^ kSecret[1]));
+    }
+};
+
+/*
+A hash in the style of XXH3. Short keys get a dedicated path per length class,
+longer keys are consumed as 16 byte lanes combined with a secret through a folded
+128 bit multiply, and the accumulator goes through a final avalanche.
+*/
+struct Xxh3Hash
+{
+    std::size_t operator()(std::string_view key) const noexcept
+    {
+        using namespace hashers_detail;
+        static constexpr auto kSecret = MakeSecret();
+        static constexpr u64 kPrime1 = 0x9E3779B185EBCA87ULL;
+        static constexpr u64 kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+
+        auto p = key.data();
+        auto len = static_cast<u64>(key.size());
+
+        if (len > 16)
+        {
+            auto acc = len * kPrime1;
+            auto mix16 = [](const char* x, std::size_t s)
+            {
+                return MultiplyFold(Read8(x) ^ kSecret[s % 16], Read8(x + 8) ^ kSecret[(s + 1) % 16]);
+            };
+
+            if (len <= 128)
+            {
+                // Lanes are taken in pairs from both ends, so every byte is covered.
+                for (std::size_t i = 0; i * 32 < len; ++i)
+                {
+                    acc += mix16(p + i * 16, i * 4);
+                    acc += mix16(p + len - 16 - i * 16, i * 4 + 2);
+                }
+            }
+            else
+            {
+                std::size_t i = 0;
+                for (; i + 16 <= len; i += 16)
+                {
+                    acc += mix16(p + i, i / 8);
+                }
+                acc += mix16(p + len - 16, 7);
+            }
+
+            return static_cast<std::size_t>(Avalanche_(acc));
+        }
+
+        if (len > 8)
+        {
+            auto lo = Read8(p) ^ kSecret[0];
+            auto hi = Read8(p + len - 8) ^ kSecret[1];
+            return static_cast<std::size_t>(Avalanche_(len + __builtin_bswap64(lo) + hi + MultiplyFold(lo, hi)));
+        }
+
+        if (len >= 4)
+        {
+            auto x = (Read4(p + len - 4) + (Read4(p) << 32)) ^ kSecret[2];
+            x ^= Rotl(x, 49) ^ Rotl(x, 24);
+            x *= 0x9FB21C651E98DF25ULL;
+            x ^= (x >> 35) + len;
+            x *= 0x9FB21C651E98DF25ULL;
+            return static_cast<std::size_t>(x ^ (x >> 28));
+        }
+
+        if (len > 0)
+        {
+            auto c = (static_cast<u64>(static_cast<unsigned char>(p[0])) << 16)
+                     | (static_cast<u64>(static_cast<unsigned char>(p[len >> 1])) << 24)
+                     | static_cast<unsigned char>(p[len - 1])
+                     | (len << 8);
+            return static_cast<std::size_t>(Avalanche_((c ^ kSecret[3]) * kPrime2));
+        }
+
+        return static_cast<std::size_t>(Avalanche_(kSecret[4]));
+    }
+
+private:
+    static hashers_detail::u64 Avalanche_(hashers_detail::u64 h) noexcept
+    {
+        h ^= h >> 37;
+        h *= 0x165667919E3779F9ULL;
+        return h ^ (h >> 32);
+    }
+};
+
+// Hashes a lookup key without materialising a Key where possible. std::hash of a
+// std::string cannot take a std::string_view, but the standard guarantees that
+// std::hash<std::string_view> gives the same value for the same characters.
+template<class Key, class Hash, class KeyView>
+std::size_t HashLookupKey(const KeyView& key)
+{
+    if constexpr (std::is_invocable_v<const Hash&, const KeyView&>)
+    {
+        return Hash{}(key);
+    }
+    else if constexpr (std::is_same_v<Hash, std::hash<std::string>>)
+    {
+        return std::hash<std::string_view>{}(key);
+    }
+    else
+    {
+        return Hash{}(Key(key));
+    }
+}
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_HASH_TABLE_HASHERS_H_
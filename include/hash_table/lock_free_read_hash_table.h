@@ -0,0 +1,102 @@
+#ifndef TRANSACTIONS_INCLUDE_HASH_TABLE_LOCK_FREE_READ_HASH_TABLE_H_
+#define TRANSACTIONS_INCLUDE_HASH_TABLE_LOCK_FREE_READ_HASH_TABLE_H_
+
+#include <functional>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+
+#include "common/storage_interface.h"
+#include "hashers.h"
+#include "common/epoch_manager.h"
+
+namespace s21
+{
+
+/*
+Chained hash table for read-mostly workloads shared between threads. GetValue
+and Exists never take a lock: they pin an epoch and walk bucket chains that
+writers only change with single atomic stores. Writers are serialised by one
+mutex. A resize builds a complete new bucket array and publishes it with one
+store, so a reader sees either the old table or the new one. Unlinked nodes,
+records and tables are handed to the EpochManager and freed once no reader can
+still hold them.
+
+Records never move, so a reference returned by GetValue stays valid until the
+key is erased. Writing through it is not synchronised with readers.
+
+Scan is a reader too: it pins an epoch and copies whole buckets from a bucket
+index cursor. A scan that sees a resize starts over.
+*/
+template<class Key, class Tp = Value, class Hash = std::hash<Key>>
+class LockFreeReadHashTable : public KeyValueStorageInterface<Key, Tp>
+{
+public:
+    using key_type = typename KeyValueStorageInterface<Key, Tp>::key_type;
+    using mapped_type = typename KeyValueStorageInterface<Key, Tp>::mapped_type;
+    using size_type = typename KeyValueStorageInterface<Key, Tp>::size_type;
+    using key_view_type = typename KeyValueStorageInterface<Key, Tp>::key_view_type;
+    using ScanCursor = typename KeyValueStorageInterface<Key, Tp>::ScanCursor;
+    using ScanResult = typename KeyValueStorageInterface<Key, Tp>::ScanResult;
+
+private:
+    struct Record final
+    {
+        key_type key{};
+        mapped_type value{};
+        size_type hash{ 0 };
+    };
+
+    struct Node final
+    {
+        Record* record{ nullptr };
+        std::atomic<Node*> next{ nullptr };
+    };
+
+    struct Table final
+    {
+        explicit Table(size_type size);
+        ~Table();
+
+        size_type size;
+        std::unique_ptr<std::atomic<Node*>[]> buckets;
+    };
+
+public:
+    LockFreeReadHashTable();
+    ~LockFreeReadHashTable() override;
+
+    LockFreeReadHashTable(const LockFreeReadHashTable&) = delete;
+    LockFreeReadHashTable& operator=(const LockFreeReadHashTable&) = delete;
+
+    bool Insert(key_type key, mapped_type value) override;
+    mapped_type& GetValue(key_view_type key) override;
+    bool Exists(key_view_type key) override;
+    bool Erase(key_view_type key) override;
+    std::vector<std::pair<key_type, mapped_type>> ShowAll() override;
+    ScanResult Scan(const ScanCursor& cursor, size_type count) override;
+    [[nodiscard]] size_type Size() const override;
+    void Reserve(size_type num_elements) override;
+
+    [[nodiscard]] size_type BucketCount() const noexcept;
+
+private:
+    Record* Find_(key_view_type key, size_type hash) const;
+    void Resize_(size_type table_size);
+    [[nodiscard]] size_type GetHashValue_(key_view_type key) const;
+
+private:
+    static constexpr size_type kMinTableSize{ 16 };
+
+    std::atomic<Table*> table_;
+    std::atomic<size_type> num_elements_{ 0 };
+    std::mutex write_mutex_;
+    EpochManager epoch_manager_;
+};
+
+} // namespace s21
+
+#include "lock_free_read_hash_table.tpp"
+
+#endif // TRANSACTIONS_INCLUDE_HASH_TABLE_LOCK_FREE_READ_HASH_TABLE_H_
@@ -0,0 +1,238 @@
+#ifndef TRANSACTIONS_INCLUDE_HASH_TABLE_LOCK_FREE_READ_HASH_TABLE_TPP_
+#define TRANSACTIONS_INCLUDE_HASH_TABLE_LOCK_FREE_READ_HASH_TABLE_TPP_
+
+#include <utility>
+
+namespace s21
+{
+
+template<class Key, class Tp, class Hash>
+LockFreeReadHashTable<Key, Tp, Hash>::Table::Table(size_type size)
+    : size(size)
+    , buckets(std::make_unique<std::atomic<Node*>[]>(size))
+{}
+
+template<class Key, class Tp, class Hash>
+LockFreeReadHashTable<Key, Tp, Hash>::Table::~Table()
+{
+    // A table owns its chain nodes but not the records they point to.
+    for (size_type i = 0; i < size; ++i)
+    {
+        for (auto node = buckets[i].load(); node;)
+        {
+            delete std::exchange(node, node->next.load());
+        }
+    }
+}
+
+template<class Key, class Tp, class Hash>
+LockFreeReadHashTable<Key, Tp, Hash>::LockFreeReadHashTable()
+    : table_(new Table(kMinTableSize))
+{}
+
+template<class Key, class Tp, class Hash>
+LockFreeReadHashTable<Key, Tp, Hash>::~LockFreeReadHashTable()
+{
+    auto table = table_.load();
+
+    for (size_type i = 0; i < table->size; ++i)
+    {
+        for (auto node = table->buckets[i].load(); node; node = node->next.load())
+        {
+            delete node->record;
+        }
+    }
+
+    delete table;
+}
+
+template<class Key, class Tp, class Hash>
+bool LockFreeReadHashTable<Key, Tp, Hash>::Insert(key_type key, mapped_type value)
+{
+    auto hash = GetHashValue_(key);
+    std::lock_guard lock(write_mutex_);
+
+    if (Find_(key, hash))
+    {
+        return false;
+    }
+
+    auto table = table_.load(std::memory_order_relaxed);
+    auto& bucket = table->buckets[hash % table->size];
+    auto node = new Node{ new Record{ std::move(key), std::move(value), hash } };
+
+    node->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    bucket.store(node, std::memory_order_release);
+
+    if (num_elements_.fetch_add(1, std::memory_order_relaxed) + 1 >= table->size)
+    {
+        Resize_(table->size * 2);
+    }
+
+    return true;
+}
+
+template<class Key, class Tp, class Hash>
+typename LockFreeReadHashTable<Key, Tp, Hash>::mapped_type& LockFreeReadHashTable<Key, Tp, Hash>::GetValue(key_view_type key)
+{
+    auto hash = GetHashValue_(key);
+    auto guard = epoch_manager_.Pin();
+
+    if (auto record = Find_(key, hash); record)
+    {
+        return record->value;
+    }
+
+    throw std::runtime_error("The value was not found.");
+}
+
+template<class Key, class Tp, class Hash>
+bool LockFreeReadHashTable<Key, Tp, Hash>::Exists(key_view_type key)
+{
+    auto hash = GetHashValue_(key);
+    auto guard = epoch_manager_.Pin();
+
+    return Find_(key, hash) != nullptr;
+}
+
+template<class Key, class Tp, class Hash>
+bool LockFreeReadHashTable<Key, Tp, Hash>::Erase(key_view_type key)
+{
+    auto hash = GetHashValue_(key);
+    std::lock_guard lock(write_mutex_);
+    auto table = table_.load(std::memory_order_relaxed);
+    auto link = &table->buckets[hash % table->size];
+
+    for (auto node = link->load(std::memory_order_relaxed); node; node = link->load(std::memory_order_relaxed))
+    {
+        if (node->record->hash == hash && node->record->key == key)
+        {
+            // Readers standing on the node can still follow its next pointer, which is
+            // left untouched until the node is freed.
+            link->store(node->next.load(std::memory_order_relaxed), std::memory_order_release);
+            num_elements_.fetch_sub(1, std::memory_order_relaxed);
+            epoch_manager_.Retire(node->record);
+            epoch_manager_.Retire(node);
+            return true;
+        }
+
+        link = &node->next;
+    }
+
+    return false;
+}
+
+template<class Key, class Tp, class Hash>
+std::vector<std::pair<typename LockFreeReadHashTable<Key, Tp, Hash>::key_type, typename LockFreeReadHashTable<Key, Tp, Hash>::mapped_type>>
+LockFreeReadHashTable<Key, Tp, Hash>::ShowAll()
+{
+    std::lock_guard lock(write_mutex_);
+    std::vector<std::pair<key_type, mapped_type>> entries;
+    auto table = table_.load(std::memory_order_relaxed);
+
+    entries.reserve(num_elements_.load(std::memory_order_relaxed));
+    for (size_type i = 0; i < table->size; ++i)
+    {
+        for (auto node = table->buckets[i].load(std::memory_order_relaxed); node; node = node->next.load(std::memory_order_relaxed))
+        {
+            entries.push_back({ node->record->key, node->record->value });
+        }
+    }
+
+    return entries;
+}
+
+template<class Key, class Tp, class Hash>
+typename LockFreeReadHashTable<Key, Tp, Hash>::ScanResult
+LockFreeReadHashTable<Key, Tp, Hash>::Scan(const ScanCursor& cursor, size_type count)
+{
+    auto guard = epoch_manager_.Pin();
+    auto table = table_.load(std::memory_order_acquire);
+    ScanResult result;
+    auto index = cursor.bucket_count == table->size ? cursor.position : 0;
+
+    for (; !cursor.finished && index < table->size && result.entries.size() < count; ++index)
+    {
+        for (auto node = table->buckets[index].load(std::memory_order_acquire); node; node = node->next.load(std::memory_order_acquire))
+        {
+            result.entries.emplace_back(node->record->key, node->record->value);
+        }
+    }
+
+    result.cursor.position = index;
+    result.cursor.bucket_count = table->size;
+    result.cursor.finished = cursor.finished || index >= table->size;
+
+    return result;
+}
+
+template<class Key, class Tp, class Hash>
+typename LockFreeReadHashTable<Key, Tp, Hash>::size_type LockFreeReadHashTable<Key, Tp, Hash>::Size() const
+{
+    return num_elements_.load(std::memory_order_relaxed);
+}
+
+template<class Key, class Tp, class Hash>
+void LockFreeReadHashTable<Key, Tp, Hash>::Reserve(size_type num_elements)
+{
+    std::lock_guard lock(write_mutex_);
+    Resize_(num_elements + 1);
+}
+
+template<class Key, class Tp, class Hash>
+typename LockFreeReadHashTable<Key, Tp, Hash>::size_type LockFreeReadHashTable<Key, Tp, Hash>::BucketCount() const noexcept
+{
+    return table_.load(std::memory_order_acquire)->size;
+}
+
+template<class Key, class Tp, class Hash>
+typename LockFreeReadHashTable<Key, Tp, Hash>::Record*
+LockFreeReadHashTable<Key, Tp, Hash>::Find_(key_view_type key, size_type hash) const
+{
+    auto table = table_.load(std::memory_order_acquire);
+
+    for (auto node = table->buckets[hash % table->size].load(std::memory_order_acquire); node; node = node->next.load(std::memory_order_acquire))
+    {
+        if (node->record->hash == hash && node->record->key == key)
+        {
+            return node->record;
+        }
+    }
+
+    return nullptr;
+}
+
+template<class Key, class Tp, class Hash>
+void LockFreeReadHashTable<Key, Tp, Hash>::Resize_(size_type table_size)
+{
+    auto old_table = table_.load(std::memory_order_relaxed);
+
+    if (old_table->size >= table_size)
+    {
+        return;
+    }
+
+    // Readers may still be walking the old chains, so they are copied rather than relinked.
+    auto table = new Table(table_size);
+    for (size_type i = 0; i < old_table->size; ++i)
+    {
+        for (auto node = old_table->buckets[i].load(std::memory_order_relaxed); node; node = node->next.load(std::memory_order_relaxed))
+        {
+            auto& bucket = table->buckets[node->record->hash % table_size];
+            bucket.store(new Node{ node->record, bucket.load(std::memory_order_relaxed) }, std::memory_order_relaxed);
+        }
+    }
+
+    table_.store(table, std::memory_order_release);
+    epoch_manager_.Retire(old_table);
+}
+
+template<class Key, class Tp, class Hash>
+typename LockFreeReadHashTable<Key, Tp, Hash>::size_type LockFreeReadHashTable<Key, Tp, Hash>::GetHashValue_(key_view_type key) const
+{
+    return HashLookupKey<Key, Hash>(key);
+}
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_HASH_TABLE_LOCK_FREE_READ_HASH_TABLE_TPP_
@@ -1,43 +1,126 @@
 #ifndef TRANSACTIONS_INCLUDE_RBTREE_KVTREE_H_
 #define TRANSACTIONS_INCLUDE_RBTREE_KVTREE_H_
 
-#include "common/storage_interface.h"
+#include "common/ordered_storage_interface.h"
 #include "rbtree.h"
 
 namespace s21
 {
 
-template<class Key, class Value = Value>
-class SelfBalancingBinarySearchTree: public KeyValueStorageInterface<Key, Value> {
+/*
+Allocator is passed on to the tree. With a PoolAllocator the nodes are packed
+into slabs and destroying the tree gives them back at once, which pays off when
+the entries own no heap memory of their own; with string keys the key buffers
+still come from the global heap, away from their nodes, and lookups get slower,
+so std::allocator stays the default.
+*/
+template<class Key, class Value = Value, class Allocator = std::allocator<std::pair<const Key, Value>>>
+class SelfBalancingBinarySearchTree: public OrderedKeyValueStorageInterface<Key, Value> {
  public:
-  template<typename T1, typename T2>
+  using key_view_type = typename KeyValueStorageInterface<Key, Value>::key_view_type;
+  using ScanCursor = typename KeyValueStorageInterface<Key, Value>::ScanCursor;
+  using ScanResult = typename KeyValueStorageInterface<Key, Value>::ScanResult;
+  using value_type = std::pair<const Key, Value>;
+
+  // Transparent, so the tree can be searched by a key view as well as by a pair.
   struct CompareByFirst {
-    bool operator()(const std::pair<T1, T2>& a, const std::pair<T1, T2>& b) const {
-      return a.first < b.first;
+    using is_transparent = void;
+
+    template<typename A, typename B>
+    bool operator()(const A& a, const B& b) const {
+      return KeyOf(a) < KeyOf(b);
     }
+
+    static const Key& KeyOf(const value_type& x) { return x.first; }
+
+    template<typename K>
+    static const K& KeyOf(const K& x) { return x; }
   };
 
-  using value_type = std::pair<const Key, Value>;
-  using tree_type = s21_utils::rbTree<value_type, CompareByFirst<const Key, Value>>;
+  using tree_type = s21_utils::rbTree<value_type, CompareByFirst, Allocator>;
   using iterator = typename tree_type::iterator;
   using const_iterator = typename tree_type::const_iterator;
 
 
-  bool Insert(const Key& key,
-    const Value& value) override
+  bool Insert(Key key, Value value) override
   {
-    auto [it, ok] = tree.addNode(std::make_pair(key, value));
+    auto [it, ok] = tree.emplaceNode(std::move(key), std::move(value));
     return ok;
   }
 
-  Value& GetValue(const Key& key) override {
-    auto [it, ok] = tree.FindKey(value_type(key, {}));
+  // Builds the tree in linear time when it is empty and the entries are sorted by unique keys.
+  std::size_t BulkLoad(std::vector<std::pair<Key, Value>> entries) override
+  {
+    auto unsorted = std::adjacent_find(entries.begin(), entries.end(), [](const auto &lhs, const auto &rhs) {
+      return !(lhs.first < rhs.first);
+    });
+
+    if (tree.Size() != 0 || unsorted != entries.end()) {
+      return KeyValueStorageInterface<Key, Value>::BulkLoad(std::move(entries));
+    }
+
+    tree.buildFromSorted(std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+    return entries.size();
+  }
+
+  /*
+  Insert and Erase for many keys at once. The batch is sorted and merged
+  with the storage by splitting and joining subtrees, on up to
+  num_threads threads. Inserted entries are first built into a tree of
+  their own in linear time, with an allocator that shares the memory of
+  the storage, so that the merge can take the nodes over. Keys that are
+  already stored, or repeated in the batch, keep their first value, as
+  with Insert. Both return how many entries they inserted or erased.
+  */
+  std::size_t InsertBatch(std::vector<std::pair<Key, Value>> entries, unsigned num_threads = 1)
+  {
+    // Values are big, so pointers are sorted and every entry is moved only once.
+    std::vector<std::pair<Key, Value> *> order;
+    order.reserve(entries.size());
+    for (auto &entry : entries) {
+      order.push_back(&entry);
+    }
+    auto byKey = [](const auto *lhs, const auto *rhs) { return lhs->first < rhs->first; };
+    if (!std::is_sorted(order.begin(), order.end(), byKey)) {
+      std::stable_sort(order.begin(), order.end(), byKey);
+    }
+    order.erase(std::unique(order.begin(), order.end(), [](const auto *lhs, const auto *rhs) {
+      return !(lhs->first < rhs->first);
+    }), order.end());
+
+    std::vector<std::pair<Key, Value>> sorted;
+    sorted.reserve(order.size());
+    for (auto *entry : order) {
+      sorted.push_back(std::move(*entry));
+    }
+
+    tree_type batch(tree.get_allocator());
+    batch.buildFromSorted(std::make_move_iterator(sorted.begin()), std::make_move_iterator(sorted.end()));
+    return tree.unionWith(std::move(batch), num_threads);
+  }
+
+  std::size_t EraseBatch(std::vector<Key> keys, unsigned num_threads = 1)
+  {
+    if (!std::is_sorted(keys.begin(), keys.end())) {
+      std::sort(keys.begin(), keys.end());
+    }
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    return tree.eraseSorted(keys.begin(), keys.end(), num_threads);
+  }
+
+  Value& GetValue(key_view_type key) override {
+    auto [it, ok] = tree.FindKey(key);
     if (!ok) throw std::runtime_error("no such key");
     return it->second;
   }
-  bool Erase(const Key& key) override
+  // Looks the key up directly instead of going through GetValue, which throws on a miss.
+  bool Exists(key_view_type key) override {
+    return tree.FindKey(key).second;
+  }
+  bool Erase(key_view_type key) override
   {
-    auto num = tree.removeNode(value_type(key,{}));
+    auto num = tree.removeKey(key);
     return num == 1;
   }
   std::vector<std::pair<Key, Value>> ShowAll() override {
@@ -48,7 +131,57 @@ class SelfBalancingBinarySearchTree: public KeyValueStorageInterface<Key, Value>
     }
     return result;
   }
+  // Resumes after the last key returned, so the cursor survives rebalancing.
+  ScanResult Scan(const ScanCursor &cursor, std::size_t count) override {
+    ScanResult result;
+    if (cursor.finished) {
+      result.cursor.finished = true;
+      return result;
+    }
+
+    auto it = cursor.last_key ? tree.upperBound(*cursor.last_key) : tree.begin();
+    for (; it != tree.end() && result.entries.size() < count; ++it) {
+      result.entries.emplace_back(it->first, it->second);
+    }
+
+    result.cursor.finished = (it == tree.end());
+    result.cursor.last_key = result.entries.empty() ? cursor.last_key : result.entries.back().first;
+    return result;
+  }
+  std::vector<std::pair<Key, Value>> RangeScan(key_view_type lower, key_view_type upper, std::size_t limit) override {
+    return scanWhile(lower, limit, [&upper](const Key &key) { return !(upper < key); });
+  }
+  std::vector<std::pair<Key, Value>> PrefixScan(key_view_type prefix, std::size_t limit) override {
+    return scanWhile(prefix, limit, [&prefix](const Key &key) {
+      return OrderedKeyValueStorageInterface<Key, Value>::HasPrefix(key, prefix);
+    });
+  }
+  std::size_t Rank(key_view_type key) override {
+    return tree.lowerRank(key);
+  }
+  std::pair<Key, Value> Select(std::size_t index) override {
+    auto it = tree.select(index);
+    if (it == tree.end()) throw std::out_of_range("The index is out of range.");
+    return {it->first, it->second};
+  }
+  std::size_t CountRange(key_view_type lower, key_view_type upper) override {
+    if (upper < lower) return 0;
+    return tree.upperRank(upper) - tree.lowerRank(lower);
+  }
+  [[nodiscard]] std::size_t Size() const override {
+    return tree.Size();
+  }
  private:
+  template <typename Predicate>
+  std::vector<std::pair<Key, Value>> scanWhile(key_view_type lower, std::size_t limit, Predicate predicate) {
+    std::vector<std::pair<Key, Value>> result;
+    for (auto it = tree.lowerBound(lower); it != tree.end() && predicate(it->first); ++it) {
+      if (limit != 0 && result.size() == limit) break;
+      result.emplace_back(it->first, it->second);
+    }
+    return result;
+  }
+
    tree_type tree;
 };
 
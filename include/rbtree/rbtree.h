@@ -1,12 +1,21 @@
 #ifndef TRANSACTIONS_INCLUDE_RBTREE_RBTREE_H_
 #define TRANSACTIONS_INCLUDE_RBTREE_RBTREE_H_
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <limits>
+#include <memory>
 #include <stack>
+#include <system_error>
+#include <thread>
 #include <vector>
 #include <queue>
+#include <type_traits>
 #include <cassert>
+#include <utility>
 
 namespace s21::s21_utils
 {
@@ -36,6 +45,13 @@ class rbTree {
   ~rbTree() { clearTree(); };
 
   rbTree(std::initializer_list<T>&& args) {
+    auto unsorted = std::adjacent_find(args.begin(), args.end(), [](const T &lhs, const T &rhs) {
+      return !Comparator{}(lhs, rhs);
+    });
+    if (unsorted == args.end()) {
+      buildFromSorted(args.begin(), args.end());
+      return;
+    }
     for (auto &&elm: args) {
       addNode(elm);
     }
@@ -47,22 +63,24 @@ class rbTree {
   */
 
   rbTree(const rbTree &other) {
-    for (auto const &elm : other) {
-      addNode(elm);
-    }
+    buildFromSorted(other.begin(), other.end());
   };
 
   /*
   ***************************
   Move constructor
 
+  other is left with a default constructed allocator. For an allocator
+  that allocates when it is constructed, such as PoolAllocator with its
+  arena, that may throw, so the move is only noexcept when it cannot.
   */
 
-  rbTree(rbTree &&other) noexcept
+  rbTree(rbTree &&other) noexcept(std::is_nothrow_default_constructible_v<node_allocator_type>)
       : root(other.root),
         leftmost(other.leftmost),
         rightmost(other.rightmost),
-        size_(other.size_) {
+        size_(other.size_),
+        nodeAllocator(std::exchange(other.nodeAllocator, node_allocator_type())) {
     other.root = nullptr;
     other.leftmost = nullptr;
     other.rightmost = nullptr;
@@ -82,45 +100,65 @@ class rbTree {
     std::swap(leftmost, other.leftmost);
     std::swap(rightmost, other.rightmost);
     std::swap(size_, other.size_);
+    std::swap(nodeAllocator, other.nodeAllocator);
     return *this;
   }
 
+  /*
+  The data lives inside the node, so a node is one allocation and a
+  comparison reads the node it already has. Nodes are at least pointer
+  aligned, which leaves the lowest bit of the parent pointer free for the
+  color.
+  */
   struct rbTreeNode {
-    ~rbTreeNode() {
-      std::allocator_traits<Allocator>::destroy(allocator, data_);
-      std::allocator_traits<Allocator>::deallocate(allocator, data_, 1);
+    template <typename... Args>
+    explicit rbTreeNode(std::in_place_t, Args &&...args)
+        : data_(std::forward<Args>(args)...) {}
+
+    rbTreeNode(const rbTreeNode &) = delete;
+    rbTreeNode &operator=(const rbTreeNode &) = delete;
+
+    rbTreeNode *getParent() const noexcept {
+      return reinterpret_cast<rbTreeNode *>(parentAndColor & ~kColorBit);
+    }
+
+    void setParent(rbTreeNode *parent) noexcept {
+      parentAndColor = reinterpret_cast<std::uintptr_t>(parent) | (parentAndColor & kColorBit);
     }
-    rbTreeNode(const rbTreeNode &) = default;
-    rbTreeNode(rbTreeNode &&) = default;
-    void swap(rbTreeNode &other) noexcept
-    {
-      if (this == &other) return;
-      std::swap(data_, other.data_);
+
+    bool color() const noexcept { return (parentAndColor & kColorBit) != 0; }
+
+    void setColor(bool color) noexcept {
+      parentAndColor = (parentAndColor & ~kColorBit) | (color ? kColorBit : 0);
     }
 
-    Allocator allocator;
+    static constexpr std::uintptr_t kColorBit = 1;
+
     rbTreeNode *left{};
     rbTreeNode *right{};
-    rbTreeNode *parent{};
-    bool rbColor = kRed;
-    data_type *data_{};
-
-    template <typename KK>
-    explicit rbTreeNode(KK &&data, const Allocator &alloc = Allocator{})
-        : allocator(alloc) {
-      data_ = std::allocator_traits<Allocator>::allocate(allocator, 1);
-      try {
-        std::allocator_traits<Allocator>::construct(allocator, data_, std::forward<KK>(data));
-      } catch (...) {
-        std::allocator_traits<Allocator>::deallocate(allocator, data_, 1);
-        throw;
-      }
-    }
+    std::uintptr_t parentAndColor = kRed;
+    // The number of nodes in the subtree of this node, itself included.
+    size_type subtreeSize = 1;
+    data_type data_;
   };
 
+  using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<rbTreeNode>;
+
+  /*
+  ***************************
+  Allocator constructor
+
+  The nodes are allocated with a copy of alloc. Trees with equal
+  allocators can hand their nodes to each other in unionWith.
+  */
+
+  explicit rbTree(const node_allocator_type &alloc) : nodeAllocator(alloc) {}
+
+  [[nodiscard]] node_allocator_type get_allocator() const noexcept { return nodeAllocator; }
+
   /*
   Header is a parent node for the root, which helps
-  to avoid checks if root->parent is nullptr. Also root is
+  to avoid checks if root->getParent() is nullptr. Also root is
   always header->left.
 
   Leftmost and righmost nodes point to the nodes with
@@ -209,9 +247,9 @@ class rbTree {
       return tmp;
     };
 
-    reference operator*() { return *ptr_->data_; }
+    reference operator*() { return ptr_->data_; }
 
-    pointer operator->() { return ptr_->data_; }
+    pointer operator->() { return &ptr_->data_; }
 
     friend bool operator!=(const self &a, const self &b) noexcept {
       return a.ptr_ != b.ptr_;
@@ -249,9 +287,9 @@ class rbTree {
       tree_ptr_ = const_cast<rbTree *>(Tree);
     };
 
-    reference operator*() const noexcept { return *ptr_->data_; }
+    reference operator*() const noexcept { return ptr_->data_; }
 
-    pointer operator->() const noexcept { return ptr_->data_; }
+    pointer operator->() const noexcept { return &ptr_->data_; }
 
     self &operator++() {
       ptr_ = tree_ptr_->getNextNode(const_cast<base_ptr>(ptr_));
@@ -322,24 +360,28 @@ class rbTree {
     return alloc1.max_size();
   }
 
+  /*
+  With an allocator that can release all its memory at once, such as
+  PoolAllocator, the nodes are only destroyed and not deallocated, and
+  with trivially destructible data they are not even visited. That is
+  not done while another tree shares the memory, as a batch built with
+  get_allocator() does.
+  */
   void clearTree() {
-    std::stack<rbTreeNode*> stack;
-    if (root != nullptr) {
-      stack.push(root);
-    }
-
-    while (!stack.empty()) {
-      rbTreeNode* current = stack.top();
-      stack.pop();
-
-      if (current->left != nullptr) {
-        stack.push(current->left);
+    bool released = false;
+    if constexpr (hasRelease<node_allocator_type>::value) {
+      if (!nodeAllocator.SharesArena()) {
+        if constexpr (!std::is_trivially_destructible_v<data_type>) {
+          forEachNode([this](rbTreeNode *node) {
+            std::allocator_traits<node_allocator_type>::destroy(nodeAllocator, node);
+          });
+        }
+        nodeAllocator.Release();
+        released = true;
       }
-      if (current->right != nullptr) {
-        stack.push(current->right);
-      }
-
-      delete current;
+    }
+    if (!released) {
+      forEachNode([this](rbTreeNode *node) { destroyNode(node); });
     }
     root= nullptr;
     leftmost= nullptr;
@@ -347,6 +389,115 @@ class rbTree {
     size_=0;
   }
 
+  /*
+  Replaces the contents with the values of [first, last), which must be
+  sorted in strictly ascending order, in linear time and without a single
+  comparison. The nodes are created first and then linked into the
+  left-leaning shape the tree keeps: a 2-3 tree of the smallest black
+  height that can hold them, where a 3-node is a black node with a red
+  left child.
+  */
+  template <typename ForwardIt>
+  void buildFromSorted(ForwardIt first, ForwardIt last) {
+    clearTree();
+    std::vector<rbTreeNode *> nodes;
+    nodes.reserve(static_cast<size_type>(std::distance(first, last)));
+    try {
+      for (; first != last; ++first) {
+        nodes.push_back(createNode(*first));
+      }
+    } catch (...) {
+      for (auto *node : nodes) {
+        destroyNode(node);
+      }
+      throw;
+    }
+    if (nodes.empty()) return;
+
+    int blackHeight = 0;
+    while ((size_type{2} << blackHeight) - 1 <= nodes.size()) {
+      ++blackHeight;
+    }
+
+    root = linkSubtree(nodes.data(), nodes.size(), blackHeight);
+    root->setParent(nullptr);
+    size_ = nodes.size();
+    leftmost = nodes.front();
+    rightmost = nodes.back();
+    assert(numBlack(root->left) == numBlack(root->right));
+  }
+
+  /*
+  Moves the values of other that the tree does not hold yet into it and
+  returns how many there were; other is left empty. The trees are
+  merged by splitting and joining subtrees instead of inserting value
+  by value, which takes O(m log(n / m + 1)) for trees of n and m values.
+  The two halves of every step are independent, and while they are big
+  enough the first one runs on a thread of its own, up to numThreads
+  threads at a time. Nodes can only move between trees whose allocators
+  are equal; otherwise the values are inserted one by one.
+  */
+  size_type unionWith(rbTree &&other, unsigned numThreads = 1) {
+    if (this == &other || other.root == nullptr) return 0;
+    if (!(nodeAllocator == other.nodeAllocator)) {
+      size_type numAdded = 0;
+      for (auto &data : other) {
+        numAdded += emplaceNode(std::move(data)).second;
+      }
+      other.clearTree();
+      return numAdded;
+    }
+
+    auto sizeBefore = size_;
+    SetOperation operation(numThreads, 0, other.size_);
+    setRoot(unite(root, other.root, 0, operation));
+    other.destroyAll(operation.otherNodes);
+    other.root = other.leftmost = other.rightmost = nullptr;
+    other.size_ = 0;
+    return size_ - sizeBefore;
+  }
+
+  /*
+  Removes the values that are also in other and returns how many there
+  were; other is left empty. Works the same way as unionWith.
+  */
+  size_type differenceWith(rbTree &&other, unsigned numThreads = 1) {
+    if (this == &other) {
+      auto numRemoved = size_;
+      clearTree();
+      return numRemoved;
+    }
+    if (other.root == nullptr) return 0;
+
+    auto sizeBefore = size_;
+    SetOperation operation(numThreads, std::min(size_, other.size_), other.size_);
+    setRoot(subtract(root, other.root, 0, operation));
+    destroyAll(operation.ownNodes);
+    other.destroyAll(operation.otherNodes);
+    other.root = other.leftmost = other.rightmost = nullptr;
+    other.size_ = 0;
+    return sizeBefore - size_;
+  }
+
+  /*
+  Removes the values equal to the keys of [first, last), which must be
+  sorted in strictly ascending order, and returns how many there were.
+  Works like differenceWith, without building a tree of the keys first:
+  the tree is split at the middle key and both halves go on with their
+  half of the keys.
+  */
+  template <typename RandomIt>
+  size_type eraseSorted(RandomIt first, RandomIt last, unsigned numThreads = 1) {
+    if (first == last || root == nullptr) return 0;
+
+    auto sizeBefore = size_;
+    auto numKeys = static_cast<size_type>(last - first);
+    SetOperation operation(numThreads, std::min(size_, numKeys), 0);
+    setRoot(subtractKeys(root, first, last, 0, operation));
+    destroyAll(operation.ownNodes);
+    return sizeBefore - size_;
+  }
+
   void addNode(std::initializer_list<data_type> &&args) {
     for (auto &&elm: args) {
       addNode(elm);
@@ -363,7 +514,28 @@ class rbTree {
     auto [node, ok] = findNode(data);
 
     if (!ok) {  // insertion for set and map. No equal values allowed
-      auto *newNode = new rbTreeNode{data};
+      auto *newNode = createNode(std::move(data));
+      insertNode(newNode, node);
+      assert(numBlack(root->left) == numBlack(root->right));
+      return std::make_pair(iterator(this, newNode), true);
+    }
+    return std::make_pair(iterator(this, node), false);
+  }
+
+  /*
+  Same as addNode(), but the data is constructed in place from key and
+  args. A data_type with a const member (like a map pair) cannot be
+  moved out of, so building it inside the node is the only way to avoid
+  a copy. key is looked up first, by itself unless it is a data_type, so
+  the comparator has to take it as FindKey does. The node is only
+  created once no equal value is found.
+  */
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplaceNode(K &&key, Args &&...args) {
+    auto [node, ok] = findNode(key);
+
+    if (!ok) {
+      auto *newNode = createNode(std::forward<K>(key), std::forward<Args>(args)...);
       insertNode(newNode, node);
       assert(numBlack(root->left) == numBlack(root->right));
       return std::make_pair(iterator(this, newNode), true);
@@ -374,7 +546,7 @@ class rbTree {
   /*
   Removes node on key. Returns number of removed nodes
   */
-  size_type removeNode(data_type data) {
+  size_type removeNode(const data_type &data) {
     auto [node, ok] = findNode(data);
     if (ok) {
       deleteNode(node);
@@ -398,13 +570,136 @@ class rbTree {
     return std::make_pair(iterator(this, node), ok);
   }
 
+  /*
+  Heterogeneous lookup and removal. Only available when the comparator is
+  transparent, so a key can be searched for without building a data_type.
+  */
+  template <typename K, typename C = Comparator, typename = typename C::is_transparent>
+  std::pair<iterator, bool> FindKey(const K &key) {
+    auto [node, ok] = findNode(key);
+    return std::make_pair(iterator(this, node), ok);
+  }
+
+  /*
+  Returns an iterator to the first element that does not go before the key,
+  or end() if there is none.
+  */
+  template <typename K, typename C = Comparator, typename = typename C::is_transparent>
+  iterator lowerBound(const K &key) const {
+    rbTreeNode *currentNode = root;
+    rbTreeNode *resultNode = nullptr;
+
+    while (currentNode) {
+      if (compareKeys(key, currentNode->data_) <= 0) {
+        resultNode = currentNode;
+        currentNode = currentNode->left;
+      } else {
+        currentNode = currentNode->right;
+      }
+    }
+
+    return iterator(this, resultNode);
+  }
+
+  /*
+  Returns an iterator to the first element that goes after the key,
+  or end() if there is none.
+  */
+  template <typename K, typename C = Comparator, typename = typename C::is_transparent>
+  iterator upperBound(const K &key) const {
+    rbTreeNode *currentNode = root;
+    rbTreeNode *resultNode = nullptr;
+
+    while (currentNode) {
+      if (compareKeys(key, currentNode->data_) < 0) {
+        resultNode = currentNode;
+        currentNode = currentNode->left;
+      } else {
+        currentNode = currentNode->right;
+      }
+    }
+
+    return iterator(this, resultNode);
+  }
+
+  /*
+  Order statistics. Every node knows the size of its subtree, so these take
+  one walk from the root. lowerRank() is the number of elements before
+  lowerBound(key), upperRank() the number before upperBound(key) and
+  select() the element with index elements before it, or end().
+  */
+  template <typename K, typename C = Comparator, typename = typename C::is_transparent>
+  size_type lowerRank(const K &key) const {
+    rbTreeNode *currentNode = root;
+    size_type rank = 0;
+
+    while (currentNode) {
+      if (compareKeys(key, currentNode->data_) <= 0) {
+        currentNode = currentNode->left;
+      } else {
+        rank += sizeOf(currentNode->left) + 1;
+        currentNode = currentNode->right;
+      }
+    }
+
+    return rank;
+  }
+
+  template <typename K, typename C = Comparator, typename = typename C::is_transparent>
+  size_type upperRank(const K &key) const {
+    rbTreeNode *currentNode = root;
+    size_type rank = 0;
+
+    while (currentNode) {
+      if (compareKeys(key, currentNode->data_) < 0) {
+        currentNode = currentNode->left;
+      } else {
+        rank += sizeOf(currentNode->left) + 1;
+        currentNode = currentNode->right;
+      }
+    }
+
+    return rank;
+  }
+
+  iterator select(size_type index) const {
+    rbTreeNode *currentNode = root;
+
+    while (currentNode) {
+      auto leftSize = sizeOf(currentNode->left);
+      if (index < leftSize) {
+        currentNode = currentNode->left;
+      } else if (index == leftSize) {
+        break;
+      } else {
+        index -= leftSize + 1;
+        currentNode = currentNode->right;
+      }
+    }
+
+    return iterator(this, currentNode);
+  }
+
+  template <typename K, typename C = Comparator, typename = typename C::is_transparent>
+  size_type removeKey(const K &key) {
+    auto [node, ok] = findNode(key);
+    if (ok) {
+      deleteNode(node);
+      if (root)
+      assert(numBlack(root->left) == numBlack(root->right));
+      return 1;
+    }
+    return 0;
+  }
+
  private:
   /*
   ***************************
   Using std::less to compare keys
   */
 
-  int compareKeys(const data_type &lk, const data_type &rk) const {
+  template <typename L, typename R>
+  int compareKeys(const L &lk, const R &rk) const {
     int res = 0;
     if (Comparator{}(lk, rk))
       res = -1;
@@ -416,12 +711,13 @@ class rbTree {
   /*
   Find the node by comparing keys. Return the result of comparement.
   */
-  std::pair<rbTreeNode *, bool> findNode(const data_type &elemX) {
+  template <typename K>
+  std::pair<rbTreeNode *, bool> findNode(const K &elemX) {
     rbTreeNode *currentNode = root;
     rbTreeNode *parentNode = nullptr;
 
     while (currentNode) {
-      auto compare_result = compareKeys(elemX, *currentNode->data_);
+      auto compare_result = compareKeys(elemX, currentNode->data_);
       parentNode = currentNode;
       if (compare_result == 0) {  // we found the node
         return std::make_pair(currentNode, true);
@@ -433,18 +729,24 @@ class rbTree {
     }
 
     return std::make_pair(parentNode, false);
-  };
+  }
 
-  bool IsRed(const rbTreeNode *node) { return node && node->rbColor == kRed; }
+  static bool IsRed(const rbTreeNode *node) { return node && node->color() == kRed; }
 
-  bool IsBlack(const rbTreeNode *node) { return !IsRed(node); }
+  static size_type sizeOf(const rbTreeNode *node) { return node ? node->subtreeSize : 0; }
+
+  static void updateSize(rbTreeNode *node) {
+    node->subtreeSize = sizeOf(node->left) + sizeOf(node->right) + 1;
+  }
+
+  static bool IsBlack(const rbTreeNode *node) { return !IsRed(node); }
 
   /*
   Link new node to the parent.
   */
   void insertNode(rbTreeNode *newNode, rbTreeNode *parentNode) {
     if (!parentNode) {
-      newNode->rbColor = kBlack;
+      newNode->setColor(kBlack);
       root = newNode;
       leftmost = newNode;
       rightmost = newNode;
@@ -452,8 +754,11 @@ class rbTree {
       return;
     }
 
-    newNode->parent = parentNode;
-    auto cmp_result = compareKeys(*parentNode->data_, *newNode->data_);
+    newNode->setParent(parentNode);
+    for (auto node = parentNode; node; node = node->getParent()) {
+      ++node->subtreeSize;
+    }
+    auto cmp_result = compareKeys(parentNode->data_, newNode->data_);
     if (cmp_result > 0) {
       parentNode->left = newNode;
       if (parentNode ==
@@ -478,21 +783,29 @@ class rbTree {
   */
 
   void rotateLeft(rbTreeNode *pivotNode) {
+    FixParents(pivotNode, pivotNode->right);
+    rotateLeftLinks(pivotNode);
+  }
+
+  // Rotates without touching the parent of pivotNode, so it works on detached subtrees too. Returns the new subtree root.
+  static rbTreeNode *rotateLeftLinks(rbTreeNode *pivotNode) {
     auto childNode = pivotNode->right;
-    FixParents(pivotNode, childNode);
     pivotNode->right = childNode->left;
-    if (childNode->left) childNode->left->parent = pivotNode;
-    childNode->parent = pivotNode->parent;
+    if (childNode->left) childNode->left->setParent(pivotNode);
+    childNode->setParent(pivotNode->getParent());
     childNode->left = pivotNode;
-    pivotNode->parent = childNode;
-    childNode->rbColor = pivotNode->rbColor;
-    pivotNode->rbColor = kRed;
+    pivotNode->setParent(childNode);
+    childNode->subtreeSize = pivotNode->subtreeSize;
+    updateSize(pivotNode);
+    childNode->setColor(pivotNode->color());
+    pivotNode->setColor(kRed);
+    return childNode;
   }
   void FixParents(const rbTreeNode *pivotNode, rbTreeNode *childNode) {
-    auto parent = pivotNode->parent;
+    auto parent = pivotNode->getParent();
     if (!parent) {
       root = childNode;
-      root->rbColor = kBlack;
+      root->setColor(kBlack);
     } else {
       if (parent->left == pivotNode) {
         parent->left = childNode;
@@ -503,27 +816,34 @@ class rbTree {
   }
 
   void rotateRight(rbTreeNode *pivotNode) {
+    FixParents(pivotNode, pivotNode->left);
+    rotateRightLinks(pivotNode);
+  }
+
+  static rbTreeNode *rotateRightLinks(rbTreeNode *pivotNode) {
     auto childNode = pivotNode->left;
-    FixParents(pivotNode, childNode);
     pivotNode->left = childNode->right;
-    if (childNode->right) childNode->right->parent = pivotNode;
-    childNode->parent = pivotNode->parent;
+    if (childNode->right) childNode->right->setParent(pivotNode);
+    childNode->setParent(pivotNode->getParent());
     childNode->right = pivotNode;
-    pivotNode->parent = childNode;
-    childNode->rbColor = pivotNode->rbColor;
-    pivotNode->rbColor = kRed;
+    pivotNode->setParent(childNode);
+    childNode->subtreeSize = pivotNode->subtreeSize;
+    updateSize(pivotNode);
+    childNode->setColor(pivotNode->color());
+    pivotNode->setColor(kRed);
+    return childNode;
   }
 
   void FlipColor(rbTreeNode *pivotNode) {
-    pivotNode->rbColor = kRed;
-    pivotNode->left->rbColor = !pivotNode->left->rbColor;
-    pivotNode->right->rbColor = !pivotNode->right->rbColor;
-    root->rbColor = kBlack;
+    pivotNode->setColor(kRed);
+    pivotNode->left->setColor(!pivotNode->left->color());
+    pivotNode->right->setColor(!pivotNode->right->color());
+    root->setColor(kBlack);
   }
 
   void balanceNode(rbTreeNode *pivotNode) {
     while (pivotNode != root) {
-      auto parent = pivotNode->parent;
+      auto parent = pivotNode->getParent();
       if (pivotNode == root) break;  // Дерево сбалансировано
 
       // Если оба потомка красные, то меняем цвета, и дальше смотрим на
@@ -545,23 +865,23 @@ class rbTree {
       // Если нода красная и левый потомок, родитель красный, то поворачиваем
       // деда, текущая нода остается прежней для свапа, продолжаем
       if (IsRed(pivotNode) && IsRed(parent)) {
-        rotateRight(parent->parent);
+        rotateRight(parent->getParent());
         continue;
       }
       // Если ни одно условие не выполнилось - дерево сбалансировано
       break;
     }
 
-    root->rbColor = kBlack;  // Корень всегда черный
+    root->setColor(kBlack);  // Корень всегда черный
   }
 
-  rbTreeNode *minNode(rbTreeNode *currentNode) {
+  static rbTreeNode *minNode(rbTreeNode *currentNode) {
     while (currentNode->left)
       currentNode = currentNode->left;
     return currentNode;
   }
 
-  rbTreeNode *maxNode(rbTreeNode *currentNode) {
+  static rbTreeNode *maxNode(rbTreeNode *currentNode) {
     while (currentNode->right)
       currentNode = currentNode->right;
     return currentNode;
@@ -571,13 +891,13 @@ class rbTree {
     if (currentNode == rightmost) return nullptr;
     if (currentNode->right) {
       return minNode(currentNode->right);
-    } else if (currentNode == currentNode->parent->left) {
-      return currentNode->parent;
+    } else if (currentNode == currentNode->getParent()->left) {
+      return currentNode->getParent();
     } else {
-      while (currentNode == currentNode->parent->right) {
-        currentNode = currentNode->parent;
+      while (currentNode == currentNode->getParent()->right) {
+        currentNode = currentNode->getParent();
       }
-      return currentNode->parent;
+      return currentNode->getParent();
     }
   }
 
@@ -586,10 +906,10 @@ class rbTree {
     if (currentNode->left) {
       return maxNode(currentNode->left);
     } else {
-      while (currentNode == currentNode->parent->left) {
-        currentNode = currentNode->parent;
+      while (currentNode == currentNode->getParent()->left) {
+        currentNode = currentNode->getParent();
       }
-      return currentNode->parent;
+      return currentNode->getParent();
     }
   }
 
@@ -606,8 +926,7 @@ class rbTree {
       // потомок - значит потомок красный, а сама нода - черная - свапаем
       auto node_to_swap =
           nodePtr->right ? minNode(nodePtr->right) : nodePtr->left;
-      nodePtr->swap(*node_to_swap);
-      node_to_delete = node_to_swap;
+      swapPositions(nodePtr, node_to_swap);
     }
     // если удаляемая нода- черная, разбираем
     if (IsBlack(node_to_delete)) {
@@ -620,7 +939,7 @@ class rbTree {
   }
 
   rbTreeNode *DeleteBlackNode(const rbTreeNode *nodePtr) {
-    auto parent = nodePtr->parent;
+    auto parent = nodePtr->getParent();
     if (!parent) return nullptr;
     // Родитель красный
     if (IsRed(parent)) {
@@ -632,40 +951,40 @@ class rbTree {
   }
 
   rbTreeNode *DeleteWithBlackParent(const rbTreeNode *node) {
-    auto parent = node->parent;
+    auto parent = node->getParent();
     auto brother = parent->left == node ? parent->right : parent->left;
     auto brother_child = brother->left;
     // Если брат красный
-    if (brother->rbColor == kRed) {
+    if (brother->color() == kRed) {
       Rotate(node);
       DeleteWithRedParent(node);
       return nullptr;
     }
     // Брат черный
     // Есть red ребенок у брата
-    if (brother_child && brother_child->rbColor == kRed) {
+    if (brother_child && brother_child->color() == kRed) {
       bool left_brother = brother == parent->left;
       Rotate(node);
       if (left_brother)
       {
         FlipColor(brother);
-        brother->rbColor = kBlack;
+        brother->setColor(kBlack);
       } else
       {
         rotateLeft(parent);
         rotateRight(brother);
         FlipColor(brother_child);
-        brother_child->rbColor = kBlack;
+        brother_child->setColor(kBlack);
       }
       return nullptr;
     }
     // Нет ребенка - меняем цвет brother и получаем дерево с bh-1
-    brother->rbColor = kRed;
+    brother->setColor(kRed);
     balanceNode(brother);
-    return brother->parent == parent ? parent: brother;
+    return brother->getParent() == parent ? parent: brother;
   }
   void Rotate(const rbTreeNode *node) {
-    auto parent = node->parent;
+    auto parent = node->getParent();
     if (parent->right == node) {
       rotateRight(parent);
     } else {
@@ -674,11 +993,11 @@ class rbTree {
   }
 
   void DeleteWithRedParent(const rbTreeNode *node) {
-    auto parent = node->parent;
+    auto parent = node->getParent();
     // Удаляем правого брата
     if (parent->right == node) {
       // у левого есть ребенок -> правый поворот
-      if (parent->left->left && parent->left->left->rbColor == kRed) {
+      if (parent->left->left && parent->left->left->color() == kRed) {
         rotateRight(parent);
         balanceNode(parent);
         return;
@@ -690,7 +1009,7 @@ class rbTree {
     }
     // Удаляем левого брата
     // у правого есть ребенок -> левый поворот
-    if (parent->right->left && parent->right->left->rbColor == kRed) {
+    if (parent->right->left && parent->right->left->color() == kRed) {
       rotateLeft(parent);
       // Проверяем бывшего ребенка правого брата
       balanceNode(parent->right);
@@ -702,12 +1021,381 @@ class rbTree {
   }
 
   void SwapColors(rbTreeNode *parent, rbTreeNode *child) {
-    parent->rbColor=kBlack;
-    child->rbColor=kRed;
+    parent->setColor(kBlack);
+    child->setColor(kRed);
+  }
+
+  template <typename A, typename = void>
+  struct hasRelease : std::false_type {};
+
+  template <typename A>
+  struct hasRelease<A, std::void_t<decltype(std::declval<A &>().Release()),
+                                   decltype(std::declval<const A &>().SharesArena())>> : std::true_type {};
+
+  // The largest number of values a 2-3 tree of the given black height holds, 3^height - 1.
+  static size_type maxValuesOf(int blackHeight) {
+    size_type values = 1;
+    for (int i = 0; i < blackHeight; ++i) {
+      values = values > std::numeric_limits<size_type>::max() / 3 ? std::numeric_limits<size_type>::max() : values * 3;
+    }
+    return values - 1;
+  }
+
+  /*
+  Links count nodes, sorted in order, into a subtree of the given black
+  height, which must be able to hold them. The root is a 2-node if its
+  two children can take the rest, otherwise a 3-node with three children,
+  and the rest is split evenly between the children.
+  */
+  rbTreeNode *linkSubtree(rbTreeNode **nodes, size_type count, int blackHeight) {
+    if (count == 0) return nullptr;
+
+    auto childMax = maxValuesOf(blackHeight - 1);
+    if (count - 1 - (count - 1) / 2 <= childMax) {
+      size_type leftCount = (count - 1) / 2;
+      return linkNode(nodes[leftCount], kBlack,
+                      linkSubtree(nodes, leftCount, blackHeight - 1),
+                      linkSubtree(nodes + leftCount + 1, count - 1 - leftCount, blackHeight - 1));
+    }
+
+    size_type firstCount = (count - 2) / 3;
+    size_type secondCount = (count - 2 - firstCount) / 2;
+    size_type thirdCount = count - 2 - firstCount - secondCount;
+    auto *red = linkNode(nodes[firstCount], kRed,
+                         linkSubtree(nodes, firstCount, blackHeight - 1),
+                         linkSubtree(nodes + firstCount + 1, secondCount, blackHeight - 1));
+    return linkNode(nodes[firstCount + secondCount + 1], kBlack, red,
+                    linkSubtree(nodes + firstCount + secondCount + 2, thirdCount, blackHeight - 1));
+  }
+
+  static rbTreeNode *linkNode(rbTreeNode *node, bool color, rbTreeNode *left, rbTreeNode *right) {
+    node->left = left;
+    node->right = right;
+    node->subtreeSize = 1;
+    for (auto *child : {left, right}) {
+      if (child) {
+        child->setParent(node);
+        node->subtreeSize += child->subtreeSize;
+      }
+    }
+    node->setColor(color);
+    return node;
+  }
+
+  /*
+  Join based set operations, after Blelloch, Ferizovic and Sun, "Just
+  Join for Parallel Ordered Sets". All of them work on detached
+  subtrees, whose roots have no parent and may be red, and never touch
+  root, so two of them can run at once on disjoint subtrees.
+  */
+
+  // Taken out of the trees during a set operation, to be destroyed afterwards.
+  struct NodeList {
+    explicit NodeList(size_type capacity) : nodes(capacity) {}
+
+    void push(rbTreeNode *node) noexcept { nodes[count++] = node; }
+
+    std::vector<rbTreeNode *> nodes;
+    std::atomic<size_type> count{0};
+  };
+
+  struct SetOperation {
+    SetOperation(unsigned numThreads, size_type numOwn, size_type numOther)
+        : ownNodes(numOwn), otherNodes(numOther) {
+      while ((1u << parallelDepth) < numThreads) {
+        ++parallelDepth;
+      }
+    }
+
+    NodeList ownNodes;
+    NodeList otherNodes;
+    // Halves at a smaller depth may run on a thread of their own.
+    int parallelDepth = 0;
+  };
+
+  struct SplitResult {
+    rbTreeNode *left = nullptr;
+    rbTreeNode *found = nullptr;
+    rbTreeNode *right = nullptr;
+  };
+
+  // Subtrees smaller than this are not worth a thread.
+  static constexpr size_type kParallelGrain = 1 << 14;
+
+  void setRoot(rbTreeNode *node) {
+    root = asRoot(node);
+    size_ = sizeOf(root);
+    leftmost = root ? minNode(root) : nullptr;
+    rightmost = root ? maxNode(root) : nullptr;
+    assert(!root || numBlack(root->left) == numBlack(root->right));
+  }
+
+  void destroyAll(NodeList &list) {
+    for (size_type i = 0; i < list.count; ++i) {
+      destroyNode(list.nodes[i]);
+    }
+  }
+
+  static rbTreeNode *asRoot(rbTreeNode *node) {
+    if (node) {
+      node->setParent(nullptr);
+      node->setColor(kBlack);
+    }
+    return node;
+  }
+
+  // Detaches both children of node and returns them.
+  static std::pair<rbTreeNode *, rbTreeNode *> detachChildren(rbTreeNode *node) {
+    std::pair<rbTreeNode *, rbTreeNode *> children(node->left, node->right);
+    for (auto *child : {node->left, node->right}) {
+      if (child) child->setParent(nullptr);
+    }
+    node->left = node->right = nullptr;
+    node->subtreeSize = 1;
+    node->setParent(nullptr);
+    return children;
+  }
+
+  // The number of black nodes on every path from node down, node included.
+  static int blackHeight(const rbTreeNode *node) {
+    int height = 0;
+    for (; node; node = node->left) {
+      height += IsBlack(node);
+    }
+    return height;
+  }
+
+  // Restores the left-leaning shape above a changed child, as an insertion does on its way up.
+  static rbTreeNode *fixUp(rbTreeNode *node) {
+    updateSize(node);
+    if (IsRed(node->right) && !IsRed(node->left)) node = rotateLeftLinks(node);
+    if (IsRed(node->left) && IsRed(node->left->left)) node = rotateRightLinks(node);
+    if (IsRed(node->left) && IsRed(node->right)) {
+      node->setColor(!node->color());
+      node->left->setColor(kBlack);
+      node->right->setColor(kBlack);
+    }
+    return node;
+  }
+
+  /*
+  Joins left, the detached node middle and right, where every value of
+  left is less than middle and every value of right greater. middle is
+  linked in as a red node on the spine of the higher tree, at the level
+  of the lower one, and the shape is then fixed on the way back up.
+  */
+  static rbTreeNode *join(rbTreeNode *left, rbTreeNode *middle, rbTreeNode *right) {
+    left = asRoot(left);
+    right = asRoot(right);
+    int leftHeight = blackHeight(left);
+    int rightHeight = blackHeight(right);
+    return leftHeight >= rightHeight ? joinRight(left, middle, right, leftHeight, rightHeight)
+                                     : joinLeft(left, middle, right, leftHeight, rightHeight);
+  }
+
+  static rbTreeNode *joinRight(rbTreeNode *node, rbTreeNode *middle, rbTreeNode *right, int height, int rightHeight) {
+    if (IsBlack(node) && height == rightHeight) {
+      return linkNode(middle, kRed, node, right);
+    }
+    node->right = joinRight(node->right, middle, right, height - IsBlack(node), rightHeight);
+    node->right->setParent(node);
+    return fixUp(node);
+  }
+
+  static rbTreeNode *joinLeft(rbTreeNode *left, rbTreeNode *middle, rbTreeNode *node, int leftHeight, int height) {
+    if (IsBlack(node) && height == leftHeight) {
+      return linkNode(middle, kRed, left, node);
+    }
+    node->left = joinLeft(left, middle, node->left, leftHeight, height - IsBlack(node));
+    node->left->setParent(node);
+    return fixUp(node);
+  }
+
+  // Joins two subtrees where every value of left is less than every value of right.
+  rbTreeNode *join2(rbTreeNode *left, rbTreeNode *right) const {
+    if (!left) return right;
+    if (!right) return left;
+    auto split = splitAt(left, maxNode(left)->data_);
+    return join(split.left, split.found, right);
+  }
+
+  // Splits node into the values less than key, the node equal to it if there is one and the values greater.
+  template <typename K>
+  SplitResult splitAt(rbTreeNode *node, const K &key) const {
+    if (!node) return {};
+    auto [left, right] = detachChildren(node);
+    auto cmp = compareKeys(key, node->data_);
+    if (cmp == 0) return {left, node, right};
+    if (cmp < 0) {
+      auto split = splitAt(left, key);
+      return {split.left, split.found, join(split.right, node, right)};
+    }
+    auto split = splitAt(right, key);
+    return {join(left, node, split.left), split.found, split.right};
+  }
+
+  // Runs both and returns their results, the first on a thread of its own if parallel is set and a thread can be had.
+  template <typename First, typename Second>
+  static std::pair<rbTreeNode *, rbTreeNode *> runBoth(bool parallel, First first, Second second) {
+    if (parallel) {
+      rbTreeNode *firstResult = nullptr;
+      std::thread worker;
+      try {
+        worker = std::thread([&firstResult, &first]() { firstResult = first(); });
+      } catch (const std::system_error &) {
+        return {first(), second()};
+      }
+      auto secondResult = second();
+      worker.join();
+      return {firstResult, secondResult};
+    }
+    return {first(), second()};
+  }
+
+  static bool worthThread(int depth, const SetOperation &operation, const rbTreeNode *a, const rbTreeNode *b) {
+    return depth < operation.parallelDepth && sizeOf(a) + sizeOf(b) >= kParallelGrain;
+  }
+
+  // Own values win over equal values of other, whose nodes are set aside.
+  rbTreeNode *unite(rbTreeNode *own, rbTreeNode *other, int depth, SetOperation &operation) const {
+    if (!other) return own;
+    if (!own) return other;
+    bool parallel = worthThread(depth, operation, own, other);
+    auto [ownLeft, ownRight] = detachChildren(own);
+    auto split = splitAt(other, own->data_);
+    if (split.found) operation.otherNodes.push(split.found);
+
+    auto [left, right] = runBoth(parallel,
+        [&, ownLeft = ownLeft, splitLeft = split.left]() { return unite(ownLeft, splitLeft, depth + 1, operation); },
+        [&, ownRight = ownRight, splitRight = split.right]() { return unite(ownRight, splitRight, depth + 1, operation); });
+    return join(left, own, right);
+  }
+
+  // Every node of other is set aside, own nodes only if other has an equal value.
+  rbTreeNode *subtract(rbTreeNode *own, rbTreeNode *other, int depth, SetOperation &operation) const {
+    if (!other) return own;
+    bool parallel = worthThread(depth, operation, own, other);
+    auto [otherLeft, otherRight] = detachChildren(other);
+    operation.otherNodes.push(other);
+    auto split = splitAt(own, other->data_);
+    if (split.found) operation.ownNodes.push(split.found);
+
+    auto [left, right] = runBoth(parallel,
+        [&, splitLeft = split.left, otherLeft = otherLeft]() { return subtract(splitLeft, otherLeft, depth + 1, operation); },
+        [&, splitRight = split.right, otherRight = otherRight]() { return subtract(splitRight, otherRight, depth + 1, operation); });
+    return join2(left, right);
+  }
+
+  // Own nodes equal to one of the keys of [first, last) are set aside.
+  template <typename RandomIt>
+  rbTreeNode *subtractKeys(rbTreeNode *own, RandomIt first, RandomIt last, int depth, SetOperation &operation) const {
+    if (!own || first == last) return own;
+    bool parallel = depth < operation.parallelDepth && sizeOf(own) + static_cast<size_type>(last - first) >= kParallelGrain;
+    auto middle = first + (last - first) / 2;
+    auto split = splitAt(own, *middle);
+    if (split.found) operation.ownNodes.push(split.found);
+
+    auto [left, right] = runBoth(parallel,
+        [&, splitLeft = split.left]() { return subtractKeys(splitLeft, first, middle, depth + 1, operation); },
+        [&, splitRight = split.right]() { return subtractKeys(splitRight, middle + 1, last, depth + 1, operation); });
+    return join2(left, right);
+  }
+
+  // Calls action on every node. The children of a node are taken before the call, so the action may destroy it.
+  template <typename Action>
+  void forEachNode(Action action) {
+    std::stack<rbTreeNode*> stack;
+    if (root != nullptr) {
+      stack.push(root);
+    }
+
+    while (!stack.empty()) {
+      rbTreeNode* current = stack.top();
+      stack.pop();
+
+      if (current->left != nullptr) {
+        stack.push(current->left);
+      }
+      if (current->right != nullptr) {
+        stack.push(current->right);
+      }
+
+      action(current);
+    }
+  }
+
+  template <typename... Args>
+  rbTreeNode *createNode(Args &&...args) {
+    auto *node = std::allocator_traits<node_allocator_type>::allocate(nodeAllocator, 1);
+    try {
+      std::allocator_traits<node_allocator_type>::construct(nodeAllocator, node, std::in_place, std::forward<Args>(args)...);
+    } catch (...) {
+      std::allocator_traits<node_allocator_type>::deallocate(nodeAllocator, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void destroyNode(rbTreeNode *node) {
+    std::allocator_traits<node_allocator_type>::destroy(nodeAllocator, node);
+    std::allocator_traits<node_allocator_type>::deallocate(nodeAllocator, node, 1);
+  }
+
+  void replaceChild(rbTreeNode *parent, rbTreeNode *oldChild, rbTreeNode *newChild) {
+    if (!parent) {
+      root = newChild;
+    } else if (parent->left == oldChild) {
+      parent->left = newChild;
+    } else {
+      parent->right = newChild;
+    }
+  }
+
+  /*
+  The data cannot be moved between nodes (the key of a map pair is
+  const), so deleteNode() swaps the places of the two nodes instead:
+  links, color and subtree size stay with the place. upper is an
+  ancestor of lower. Iterators to both nodes stay valid.
+  */
+  void swapPositions(rbTreeNode *upper, rbTreeNode *lower) {
+    auto upperParent = upper->getParent();
+    auto upperLeft = upper->left;
+    auto upperRight = upper->right;
+    auto lowerParent = lower->getParent();
+    auto lowerLeft = lower->left;
+    auto lowerRight = lower->right;
+    auto upperColor = upper->color();
+
+    replaceChild(upperParent, upper, lower);
+    lower->setParent(upperParent);
+    if (lowerParent == upper) {
+      lower->left = upperLeft == lower ? upper : upperLeft;
+      lower->right = upperRight == lower ? upper : upperRight;
+      upper->setParent(lower);
+    } else {
+      lower->left = upperLeft;
+      lower->right = upperRight;
+      replaceChild(lowerParent, lower, upper);
+      upper->setParent(lowerParent);
+    }
+    upper->left = lowerLeft;
+    upper->right = lowerRight;
+
+    for (auto node : {lower, upper}) {
+      if (node->left) node->left->setParent(node);
+      if (node->right) node->right->setParent(node);
+    }
+
+    upper->setColor(lower->color());
+    lower->setColor(upperColor);
+    std::swap(upper->subtreeSize, lower->subtreeSize);
+
+    if (leftmost == upper) leftmost = lower; else if (leftmost == lower) leftmost = upper;
+    if (rightmost == upper) rightmost = lower; else if (rightmost == lower) rightmost = upper;
   }
 
   void EraseNode(rbTreeNode *node) {
-    auto parent = node->parent;
+    auto parent = node->getParent();
     if (!parent) {
       root = nullptr;
       leftmost = nullptr;
@@ -720,8 +1408,11 @@ class rbTree {
       } else {
         parent->right = nullptr;
       }
+      for (auto ancestor = parent; ancestor; ancestor = ancestor->getParent()) {
+        --ancestor->subtreeSize;
+      }
     }
-    delete node;
+    destroyNode(node);
     --size_;
   }
 
@@ -730,7 +1421,7 @@ class rbTree {
     int blackleft = numBlack(subRoot->left);
     int blackright = numBlack(subRoot->right);
     if (blackleft != blackright) throw std::runtime_error("internal");
-    if (subRoot->rbColor == kBlack) {
+    if (subRoot->color() == kBlack) {
       blackleft += 1;
     }
     return blackleft;
@@ -741,6 +1432,7 @@ private:
   rbTreeNode *leftmost{};
   rbTreeNode *rightmost{};
   size_type size_ = 0;
+  node_allocator_type nodeAllocator;
 };
 
 } // namespace s21::s21_utils
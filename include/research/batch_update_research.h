@@ -0,0 +1,123 @@
+#ifndef TRANSACTIONS_INCLUDE_RESEARCH_BATCH_UPDATE_RESEARCH_H_
+#define TRANSACTIONS_INCLUDE_RESEARCH_BATCH_UPDATE_RESEARCH_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "common/storage_struct.h"
+#include "common/timer.h"
+#include "common/data_generator.h"
+
+namespace s21
+{
+
+struct BatchUpdateResult
+{
+    double insert_ms{ 0 };
+    double erase_ms{ 0 };
+};
+
+/*
+Loads a tree with num_keys keys and then inserts a batch of new keys and erases
+them again, either one by one through Insert and Erase or all at once through
+InsertBatch and EraseBatch. Only the insertion and the erasure are timed, not
+the load or the copies of the batch handed over.
+*/
+template<class Tree>
+class BatchUpdateResearch
+{
+public:
+    using key_type = typename Tree::key_type;
+    using mapped_type = typename Tree::mapped_type;
+    using size_type = typename Tree::size_type;
+    using Result = BatchUpdateResult;
+
+    static constexpr size_type kKeyLength{ 16 };
+
+public:
+    BatchUpdateResearch(size_type num_keys, size_type batch_size)
+        : value_{ "last_name", "first_name", 2000, "city", 100 }
+    {
+        keys_ = generator_.GenerateNStrings(num_keys, kKeyLength);
+        std::sort(keys_.begin(), keys_.end());
+        keys_.erase(std::unique(keys_.begin(), keys_.end()), keys_.end());
+        // One character longer, so none of them is loaded already.
+        batch_keys_ = generator_.GenerateNStrings(batch_size, kKeyLength + 1);
+    }
+
+    Result RunOneByOne()
+    {
+        Result result;
+        Tree tree;
+        Load_(tree);
+
+        result.insert_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : batch_keys_)
+            {
+                tree.Insert(key, value_);
+            }
+        });
+        result.erase_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : batch_keys_)
+            {
+                tree.Erase(key);
+            }
+        });
+
+        return result;
+    }
+
+    Result RunBatch(unsigned num_threads)
+    {
+        Result result;
+        Tree tree;
+        Load_(tree);
+
+        std::vector<std::pair<key_type, mapped_type>> entries;
+        entries.reserve(batch_keys_.size());
+        for (const auto& key : batch_keys_)
+        {
+            entries.emplace_back(key, value_);
+        }
+        auto keys = batch_keys_;
+
+        result.insert_ms = timer_.MarkTime(1, [&]()
+        {
+            tree.InsertBatch(std::move(entries), num_threads);
+        });
+        result.erase_ms = timer_.MarkTime(1, [&]()
+        {
+            tree.EraseBatch(std::move(keys), num_threads);
+        });
+
+        return result;
+    }
+
+private:
+    void Load_(Tree& tree)
+    {
+        std::vector<std::pair<key_type, mapped_type>> entries;
+        entries.reserve(keys_.size());
+        for (const auto& key : keys_)
+        {
+            entries.emplace_back(key, value_);
+        }
+
+        tree.BulkLoad(std::move(entries));
+    }
+
+private:
+    DataGenerator generator_;
+    Timer<> timer_;
+    std::vector<key_type> keys_;
+    std::vector<key_type> batch_keys_;
+    mapped_type value_;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_RESEARCH_BATCH_UPDATE_RESEARCH_H_
@@ -0,0 +1,141 @@
+#ifndef TRANSACTIONS_INCLUDE_RESEARCH_CHURN_RESEARCH_H_
+#define TRANSACTIONS_INCLUDE_RESEARCH_CHURN_RESEARCH_H_
+
+#include <string>
+#include <vector>
+#include <random>
+#include <memory>
+#include <fstream>
+#include <unistd.h>
+
+#include "common/storage_struct.h"
+#include "common/timer.h"
+#include "common/data_generator.h"
+#include "common/allocation_counter.h"
+
+namespace s21
+{
+
+struct ChurnResult
+{
+    double fill_ms{ 0 };
+    double churn_ops_per_ms{ 0 };
+    double heap_mb{ 0 };
+    double rss_mb{ 0 };
+    double teardown_ms{ 0 };
+};
+
+/*
+Fills a storage and then keeps its size constant while replacing its keys: every
+second operation erases a random key that is in the storage and the others insert
+a new one. Reports the throughput of that churn and the memory the process holds
+afterwards, both as heap memory of the storage (from AllocationCounter) and as
+the growth of the resident set since before the fill (from /proc/self/statm).
+RunAndDestroy also times destroying the storage afterwards.
+*/
+template<class Storage>
+class ChurnResearch
+{
+public:
+    using key_type = typename Storage::key_type;
+    using mapped_type = typename Storage::mapped_type;
+    using size_type = typename Storage::size_type;
+    using Result = ChurnResult;
+
+    static constexpr size_type kKeyLength{ 16 };
+
+public:
+    ChurnResearch(size_type num_keys, size_type num_ops)
+        : num_ops_(num_ops)
+        , value_{ "last_name", "first_name", 2000, "city", 100 }
+    {
+        keys_ = generator_.GenerateNStrings(num_keys, kKeyLength);
+        new_keys_ = generator_.GenerateNStrings(num_ops / 2 + 1, kKeyLength + 1);
+    }
+
+    Result Run(Storage& storage)
+    {
+        Result result;
+        std::mt19937 generator(static_cast<std::mt19937::result_type>(keys_.size()));
+        auto live_keys = keys_;
+        auto rss_before = ResidentBytes_();
+        auto before = AllocationCounter::Now();
+
+        result.fill_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : keys_)
+            {
+                storage.Insert(key, value_);
+            }
+        });
+
+        auto churn_ms = timer_.MarkTime(1, [&]()
+        {
+            size_type next_key = 0;
+
+            for (size_type i = 0; i < num_ops_; ++i)
+            {
+                if (i % 2 == 0 && !live_keys.empty())
+                {
+                    std::uniform_int_distribution<size_type> distribution(0, live_keys.size() - 1);
+                    auto index = distribution(generator);
+
+                    storage.Erase(live_keys[index]);
+                    std::swap(live_keys[index], live_keys.back());
+                    live_keys.pop_back();
+                }
+                else
+                {
+                    storage.Insert(new_keys_[next_key], value_);
+                    live_keys.push_back(new_keys_[next_key++]);
+                }
+            }
+        });
+
+        auto after = AllocationCounter::Now();
+        result.churn_ops_per_ms = churn_ms > 0 ? static_cast<double>(num_ops_) / static_cast<double>(churn_ms) : 0;
+        result.heap_mb = static_cast<double>(after.live_bytes - before.live_bytes) / (1024.0 * 1024.0);
+        result.rss_mb = static_cast<double>(ResidentBytes_() - rss_before) / (1024.0 * 1024.0);
+
+        return result;
+    }
+
+    Result RunAndDestroy(std::unique_ptr<Storage> storage)
+    {
+        auto result = Run(*storage);
+        result.teardown_ms = timer_.MarkTime(1, [&]()
+        {
+            storage.reset();
+        });
+
+        return result;
+    }
+
+private:
+    // The second field of /proc/self/statm is the resident set in pages; zero where there is no such file.
+    static double ResidentBytes_()
+    {
+        std::ifstream statm("/proc/self/statm");
+        double total_pages = 0;
+        double resident_pages = 0;
+
+        if (!(statm >> total_pages >> resident_pages))
+        {
+            return 0;
+        }
+
+        return resident_pages * static_cast<double>(sysconf(_SC_PAGESIZE));
+    }
+
+private:
+    DataGenerator generator_;
+    Timer<> timer_;
+    std::vector<key_type> keys_;
+    std::vector<key_type> new_keys_;
+    size_type num_ops_;
+    mapped_type value_;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_RESEARCH_CHURN_RESEARCH_H_
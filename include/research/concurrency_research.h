@@ -0,0 +1,110 @@
+#ifndef TRANSACTIONS_INCLUDE_RESEARCH_CONCURRENCY_RESEARCH_H_
+#define TRANSACTIONS_INCLUDE_RESEARCH_CONCURRENCY_RESEARCH_H_
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <random>
+#include <chrono>
+
+#include "common/storage_struct.h"
+#include "common/data_generator.h"
+
+namespace s21
+{
+
+/*
+Drives a thread-safe storage from several threads at once. Reads go to a
+prefilled key set that is never modified, so they always hit. Writes insert and
+then erase keys private to the writing thread, so the size of the storage stays
+constant during the run.
+*/
+template<class Storage>
+class ConcurrencyResearch
+{
+public:
+    using key_type = typename Storage::key_type;
+    using mapped_type = typename Storage::mapped_type;
+    using size_type = typename Storage::size_type;
+    using clock_type = std::chrono::steady_clock;
+
+public:
+    ConcurrencyResearch(size_type num_keys, size_type key_length, size_type ops_per_thread, size_type read_percent)
+        : key_length_(key_length)
+        , ops_per_thread_(ops_per_thread)
+        , read_percent_(read_percent)
+        , value_{ "last_name", "first_name", 2000, "city", 100 }
+    {
+        keys_ = generator_.GenerateNStrings(num_keys, key_length);
+    }
+
+    // Returns the throughput in operations per millisecond.
+    double Run(Storage& storage, size_type num_threads)
+    {
+        if (keys_.empty() || num_threads == 0)
+        {
+            return 0;
+        }
+
+        for (const auto& key : keys_)
+        {
+            storage.Insert(key, value_);
+        }
+
+        std::vector<std::vector<key_type>> write_keys(num_threads);
+        for (auto& thread_keys : write_keys)
+        {
+            // Writer keys are one character longer, so they never collide with the read set.
+            thread_keys = generator_.GenerateNStrings(ops_per_thread_ / 2 + 1, key_length_ + 1);
+        }
+
+        std::vector<std::thread> threads;
+        auto start_time = clock_type::now();
+
+        for (size_type t = 0; t < num_threads; ++t)
+        {
+            threads.emplace_back([&, t]()
+            {
+                std::mt19937 generator(static_cast<std::mt19937::result_type>(t));
+                std::uniform_int_distribution<size_type> distribution(0, keys_.size() - 1);
+                size_type num_writes = 0;
+
+                for (size_type i = 0; i < ops_per_thread_; ++i)
+                {
+                    if (i % 100 < read_percent_)
+                    {
+                        storage.GetValue(keys_[distribution(generator)]);
+                    }
+                    else if (num_writes++ % 2 == 0)
+                    {
+                        storage.Insert(write_keys[t][num_writes / 2], value_);
+                    }
+                    else
+                    {
+                        storage.Erase(write_keys[t][num_writes / 2 - 1]);
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        auto elapsed = std::chrono::duration<double, std::milli>(clock_type::now() - start_time).count();
+        return static_cast<double>(ops_per_thread_ * num_threads) / elapsed;
+    }
+
+private:
+    DataGenerator generator_;
+    std::vector<key_type> keys_;
+    size_type key_length_;
+    size_type ops_per_thread_;
+    size_type read_percent_;
+    mapped_type value_;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_RESEARCH_CONCURRENCY_RESEARCH_H_
@@ -0,0 +1,115 @@
+#ifndef TRANSACTIONS_INCLUDE_RESEARCH_ERASE_CYCLE_RESEARCH_H_
+#define TRANSACTIONS_INCLUDE_RESEARCH_ERASE_CYCLE_RESEARCH_H_
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "common/storage_struct.h"
+#include "common/timer.h"
+#include "common/data_generator.h"
+#include "common/allocation_counter.h"
+
+namespace s21
+{
+
+struct EraseCycleResult
+{
+    double erase_ms{ 0 };
+    double reinsert_ms{ 0 };
+    double hit_ms{ 0 };
+    double heap_mb{ 0 };
+};
+
+/*
+Fills a storage and then, num_cycles times, erases a random part of its keys and
+inserts them again. erase_ms and reinsert_ms are the totals over all cycles,
+hit_ms is the time of looking every key up once afterwards and heap_mb the heap
+memory the storage holds at the end.
+
+Run takes a callable that is called after the erases of every cycle, which is
+where a storage can pack itself before the keys come back.
+*/
+template<class Storage>
+class EraseCycleResearch
+{
+public:
+    using key_type = typename Storage::key_type;
+    using mapped_type = typename Storage::mapped_type;
+    using size_type = typename Storage::size_type;
+    using Result = EraseCycleResult;
+
+    static constexpr size_type kKeyLength{ 16 };
+
+public:
+    EraseCycleResearch(size_type num_keys, size_type num_cycles, double erase_fraction)
+        : num_cycles_(num_cycles)
+        , num_erased_(std::min(num_keys, static_cast<size_type>(static_cast<double>(num_keys) * erase_fraction)))
+        , value_{ "last_name", "first_name", 2000, "city", 100 }
+    {
+        keys_ = generator_.GenerateNStrings(num_keys, kKeyLength);
+    }
+
+    Result Run(Storage& storage)
+    {
+        return Run(storage, [](){});
+    }
+
+    template<class AfterErase>
+    Result Run(Storage& storage, AfterErase after_erase)
+    {
+        Result result;
+        std::mt19937 generator(static_cast<std::mt19937::result_type>(keys_.size()));
+        auto keys = keys_;
+        auto before = AllocationCounter::Now();
+
+        for (const auto& key : keys)
+        {
+            storage.Insert(key, value_);
+        }
+
+        for (size_type cycle = 0; cycle < num_cycles_; ++cycle)
+        {
+            std::shuffle(keys.begin(), keys.end(), generator);
+            result.erase_ms += timer_.MarkTime(1, [&]()
+            {
+                for (size_type i = 0; i < num_erased_; ++i)
+                {
+                    storage.Erase(keys[i]);
+                }
+                after_erase();
+            });
+            result.reinsert_ms += timer_.MarkTime(1, [&]()
+            {
+                for (size_type i = 0; i < num_erased_; ++i)
+                {
+                    storage.Insert(keys[i], value_);
+                }
+            });
+        }
+
+        result.hit_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : keys_)
+            {
+                storage.Exists(key);
+            }
+        });
+        result.heap_mb = static_cast<double>(AllocationCounter::Now().live_bytes - before.live_bytes) / (1024.0 * 1024.0);
+
+        return result;
+    }
+
+private:
+    DataGenerator generator_;
+    Timer<> timer_;
+    std::vector<key_type> keys_;
+    size_type num_cycles_;
+    size_type num_erased_;
+    mapped_type value_;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_RESEARCH_ERASE_CYCLE_RESEARCH_H_
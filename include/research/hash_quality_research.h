@@ -0,0 +1,138 @@
+#ifndef TRANSACTIONS_INCLUDE_RESEARCH_HASH_QUALITY_RESEARCH_H_
+#define TRANSACTIONS_INCLUDE_RESEARCH_HASH_QUALITY_RESEARCH_H_
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+#include "common/storage_struct.h"
+#include "common/timer.h"
+#include "common/data_generator.h"
+#include "hash_table/hash_table.h"
+
+namespace s21
+{
+
+/*
+Compares hash functions on the key shapes the storage sees in practice: short and
+long random keys and sequential keys that differ only in their last characters.
+For every hasher it reports raw hashing speed, HashTable throughput and the
+shape of the resulting bucket chains.
+*/
+class HashQualityResearch
+{
+public:
+    using key_type = std::string;
+    using mapped_type = Value;
+    using size_type = std::size_t;
+    using clock_type = std::chrono::steady_clock;
+
+    static constexpr size_type kMaxChainLength{ 5 };
+
+    struct KeyShape
+    {
+        std::string name;
+        std::vector<key_type> keys;
+    };
+
+    struct Result
+    {
+        double hash_ns{ 0 };
+        double insert_ms{ 0 };
+        double lookup_ms{ 0 };
+        // chain_lengths[i] is the share of buckets holding i entries, the last one
+        // counts kMaxChainLength entries or more.
+        std::vector<double> chain_lengths;
+        size_type max_chain_length{ 0 };
+        double mean_probe_length{ 0 };
+    };
+
+public:
+    explicit HashQualityResearch(size_type num_keys)
+    {
+        shapes_.push_back({ "random, 8 chars", generator_.GenerateNStrings(num_keys, 8) });
+        shapes_.push_back({ "random, 32 chars", generator_.GenerateNStrings(num_keys, 32) });
+        shapes_.push_back({ "random, 200 chars", generator_.GenerateNStrings(num_keys, 200) });
+
+        KeyShape sequential{ "sequential \"key<N>\"", {} };
+        for (size_type i = 0; i < num_keys; ++i)
+        {
+            sequential.keys.push_back("key" + std::to_string(i));
+        }
+        shapes_.push_back(std::move(sequential));
+    }
+
+    [[nodiscard]] const std::vector<KeyShape>& Shapes() const noexcept
+    {
+        return shapes_;
+    }
+
+    template<class Hash>
+    Result Run(const KeyShape& shape)
+    {
+        Result result;
+        HashTable<key_type, mapped_type, Hash> hash_table;
+        const auto& keys = shape.keys;
+
+        if (keys.empty())
+        {
+            return result;
+        }
+
+        // The volatile sink keeps the hashing loop from being optimised away.
+        volatile size_type checksum = 0;
+        auto start_time = clock_type::now();
+        for (const auto& key : keys)
+        {
+            checksum = checksum + Hash{}(key);
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(clock_type::now() - start_time).count();
+        result.hash_ns = elapsed / static_cast<double>(keys.size());
+
+        result.insert_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : keys)
+            {
+                hash_table.Insert(key, value_);
+            }
+        });
+        result.lookup_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : keys)
+            {
+                hash_table.GetValue(key);
+            }
+        });
+
+        std::vector<size_type> counts(kMaxChainLength + 1);
+        size_type total_probes = 0;
+        for (size_type i = 0; i < hash_table.BucketCount(); ++i)
+        {
+            auto length = hash_table.BucketSize(i);
+
+            ++counts[std::min(length, kMaxChainLength)];
+            result.max_chain_length = std::max(result.max_chain_length, length);
+            // Finding the k-th entry of a chain compares k keys.
+            total_probes += length * (length + 1) / 2;
+        }
+
+        for (auto count : counts)
+        {
+            result.chain_lengths.push_back(100.0 * static_cast<double>(count) / static_cast<double>(hash_table.BucketCount()));
+        }
+        result.mean_probe_length = static_cast<double>(total_probes) / static_cast<double>(hash_table.Size());
+
+        return result;
+    }
+
+private:
+    DataGenerator generator_;
+    Timer<> timer_;
+    std::vector<KeyShape> shapes_;
+    mapped_type value_{ "last_name", "first_name", 2000, "city", 100 };
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_RESEARCH_HASH_QUALITY_RESEARCH_H_
@@ -0,0 +1,92 @@
+#ifndef TRANSACTIONS_INCLUDE_RESEARCH_INSERT_LATENCY_RESEARCH_H_
+#define TRANSACTIONS_INCLUDE_RESEARCH_INSERT_LATENCY_RESEARCH_H_
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <numeric>
+
+#include "common/storage_struct.h"
+#include "common/data_generator.h"
+
+namespace s21
+{
+
+/*
+Times every insert separately, so that the cost of a resize shows up in the tail
+of the distribution instead of being averaged away.
+*/
+template<class Storage>
+class InsertLatencyResearch
+{
+public:
+    using key_type = typename Storage::key_type;
+    using mapped_type = typename Storage::mapped_type;
+    using size_type = typename Storage::size_type;
+    using clock_type = std::chrono::steady_clock;
+
+    struct Result
+    {
+        double p50_us{ 0 };
+        double p99_us{ 0 };
+        double p999_us{ 0 };
+        double max_us{ 0 };
+        double total_ms{ 0 };
+    };
+
+public:
+    InsertLatencyResearch(size_type num_keys, size_type key_length)
+        : keys_(DataGenerator{}.GenerateNStrings(num_keys, key_length))
+        , value_{ "last_name", "first_name", 2000, "city", 100 }
+    {}
+
+    Result Run(Storage& storage)
+    {
+        std::vector<clock_type::duration> latencies;
+        latencies.reserve(keys_.size());
+
+        for (const auto& key : keys_)
+        {
+            auto start_time = clock_type::now();
+            storage.Insert(key, value_);
+            latencies.push_back(clock_type::now() - start_time);
+        }
+
+        if (latencies.empty())
+        {
+            return {};
+        }
+
+        Result result;
+        auto total = std::accumulate(latencies.begin(), latencies.end(), clock_type::duration::zero());
+        std::sort(latencies.begin(), latencies.end());
+
+        result.p50_us = ToMicroseconds_(Percentile_(latencies, 0.5));
+        result.p99_us = ToMicroseconds_(Percentile_(latencies, 0.99));
+        result.p999_us = ToMicroseconds_(Percentile_(latencies, 0.999));
+        result.max_us = ToMicroseconds_(latencies.back());
+        result.total_ms = ToMicroseconds_(total) / 1000.0;
+
+        return result;
+    }
+
+private:
+    static clock_type::duration Percentile_(const std::vector<clock_type::duration>& sorted, double percentile)
+    {
+        return sorted[static_cast<size_type>(percentile * static_cast<double>(sorted.size() - 1))];
+    }
+
+    static double ToMicroseconds_(clock_type::duration duration)
+    {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    }
+
+private:
+    std::vector<key_type> keys_;
+    mapped_type value_;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_RESEARCH_INSERT_LATENCY_RESEARCH_H_
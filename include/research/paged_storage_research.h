@@ -0,0 +1,100 @@
+#ifndef TRANSACTIONS_INCLUDE_RESEARCH_PAGED_STORAGE_RESEARCH_H_
+#define TRANSACTIONS_INCLUDE_RESEARCH_PAGED_STORAGE_RESEARCH_H_
+
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+
+#include "common/storage_struct.h"
+#include "common/timer.h"
+#include "common/data_generator.h"
+#include "common/allocation_counter.h"
+
+namespace s21
+{
+
+struct PagedStorageResult
+{
+    double fill_ms{ 0 };
+    double heap_mb{ 0 };
+    double hit_us{ 0 };
+};
+
+/*
+Fills a storage with random keys and then looks up random keys of it, and reports
+how much heap memory the storage holds after the fill. For a storage that keeps
+its data in a file, the heap memory stays at the size of its cache however many
+keys it holds. The memory is read from AllocationCounter, so it is only known in
+a binary that links allocation_counter.cc.
+*/
+template<class Storage>
+class PagedStorageResearch
+{
+public:
+    using key_type = typename Storage::key_type;
+    using mapped_type = typename Storage::mapped_type;
+    using size_type = typename Storage::size_type;
+    using clock_type = std::chrono::steady_clock;
+    using Result = PagedStorageResult;
+
+    static constexpr size_type kKeyLength{ 16 };
+
+public:
+    PagedStorageResearch(size_type num_keys, size_type num_lookups)
+        : value_{ "last_name", "first_name", 2000, "city", 100 }
+    {
+        std::mt19937 generator(num_keys);
+
+        keys_ = generator_.GenerateNStrings(num_keys, kKeyLength);
+        if (!keys_.empty())
+        {
+            std::uniform_int_distribution<size_type> distribution(0, keys_.size() - 1);
+            for (size_type i = 0; i < num_lookups; ++i)
+            {
+                lookup_keys_.push_back(keys_[distribution(generator)]);
+            }
+        }
+    }
+
+    Result Run(Storage& storage)
+    {
+        Result result;
+        auto before = AllocationCounter::Now();
+
+        result.fill_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : keys_)
+            {
+                storage.Insert(key, value_);
+            }
+        });
+
+        auto after = AllocationCounter::Now();
+        result.heap_mb = static_cast<double>(after.live_bytes - before.live_bytes) / (1024.0 * 1024.0);
+
+        if (!lookup_keys_.empty())
+        {
+            auto start_time = clock_type::now();
+            for (const auto& key : lookup_keys_)
+            {
+                storage.GetValue(key);
+            }
+            result.hit_us = std::chrono::duration<double, std::micro>(clock_type::now() - start_time).count()
+                            / static_cast<double>(lookup_keys_.size());
+        }
+
+        return result;
+    }
+
+private:
+    DataGenerator generator_;
+    Timer<> timer_;
+    std::vector<key_type> keys_;
+    std::vector<key_type> lookup_keys_;
+    mapped_type value_;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_RESEARCH_PAGED_STORAGE_RESEARCH_H_
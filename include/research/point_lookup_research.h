@@ -0,0 +1,210 @@
+#ifndef TRANSACTIONS_INCLUDE_RESEARCH_POINT_LOOKUP_RESEARCH_H_
+#define TRANSACTIONS_INCLUDE_RESEARCH_POINT_LOOKUP_RESEARCH_H_
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <type_traits>
+
+#include "common/storage_struct.h"
+#include "common/timer.h"
+#include "common/data_generator.h"
+#include "common/allocation_counter.h"
+
+namespace s21
+{
+
+struct PointLookupResult
+{
+    double fill_ms{ 0 };
+    double hit_ns{ 0 };
+    double miss_ns{ 0 };
+    // Heap memory and blocks the storage took per stored entry.
+    double bytes_per_entry{ 0 };
+    double allocations_per_entry{ 0 };
+    // Heap blocks taken per lookup.
+    double allocations_per_hit{ 0 };
+    double allocations_per_miss{ 0 };
+};
+
+/*
+Keys that share long prefixes, like "tenant-0003/customer-00000123/order-48213770".
+There are about kOrdersPerCustomer keys per customer in a storage of num_keys keys,
+so that neighbouring keys share everything up to the order number.
+*/
+class SharedPrefixKeys
+{
+public:
+    using size_type = std::size_t;
+
+    static constexpr size_type kNumTenants{ 16 };
+    static constexpr size_type kOrdersPerCustomer{ 32 };
+    static constexpr size_type kKeyLength{ 44 };
+
+public:
+    explicit SharedPrefixKeys(size_type num_keys)
+        : num_customers_(std::max<size_type>(1, num_keys / kNumTenants / kOrdersPerCustomer))
+    {}
+
+    std::vector<std::string> operator()(size_type count, std::mt19937& generator) const
+    {
+        static constexpr char kFormat[] = "tenant-%04zu/customer-%08zu/order-%08zu";
+
+        std::uniform_int_distribution<size_type> tenants(0, kNumTenants - 1);
+        std::uniform_int_distribution<size_type> customers(0, num_customers_ - 1);
+        std::uniform_int_distribution<size_type> orders(0, 99999999);
+        std::vector<std::string> keys;
+        char buffer[kKeyLength + 1];
+
+        for (size_type i = 0; i < count; ++i)
+        {
+            std::snprintf(buffer, sizeof(buffer), kFormat, tenants(generator), customers(generator), orders(generator));
+            keys.emplace_back(buffer);
+        }
+
+        return keys;
+    }
+
+private:
+    size_type num_customers_;
+};
+
+/*
+Measures point lookups in a filled storage. Keys are looked up in a random order,
+so consecutive lookups do not walk down an already cached path. The keys come from
+a key generator; by default string keys are random of the given length and integer
+keys are random. The heap memory taken by the fill and by the lookups is counted
+with AllocationCounter, so it is only known in a binary that links
+allocation_counter.cc.
+*/
+template<class Storage>
+class PointLookupResearch
+{
+public:
+    using key_type = typename Storage::key_type;
+    using mapped_type = typename Storage::mapped_type;
+    using size_type = typename Storage::size_type;
+    using clock_type = std::chrono::steady_clock;
+    using Result = PointLookupResult;
+    // Returns count keys, drawing what it needs from the given engine.
+    using KeyGenerator = std::function<std::vector<key_type>(size_type count, std::mt19937& generator)>;
+
+public:
+    PointLookupResearch(size_type num_keys, size_type key_length, size_type num_lookups)
+        : PointLookupResearch(num_keys, num_lookups, RandomKeys_(key_length))
+    {}
+
+    PointLookupResearch(size_type num_keys, size_type num_lookups, const KeyGenerator& generate_keys)
+    {
+        std::mt19937 generator(num_keys);
+
+        keys_ = generate_keys(num_keys, generator);
+        missing_keys_ = generate_keys(num_lookups, generator);
+        value_ = mapped_type{ "last_name", "first_name", 2000, "city", 100 };
+
+        if (!keys_.empty())
+        {
+            std::uniform_int_distribution<size_type> distribution(0, keys_.size() - 1);
+            for (size_type i = 0; i < num_lookups; ++i)
+            {
+                lookup_keys_.push_back(keys_[distribution(generator)]);
+            }
+        }
+    }
+
+    Result Run(Storage& storage)
+    {
+        Result result;
+        auto before = AllocationCounter::Now();
+
+        result.fill_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : keys_)
+            {
+                storage.Insert(key, value_);
+            }
+        });
+
+        auto after = AllocationCounter::Now();
+        if (storage.Size() != 0)
+        {
+            auto num_entries = static_cast<double>(storage.Size());
+            result.bytes_per_entry = static_cast<double>(after.live_bytes - before.live_bytes) / num_entries;
+            result.allocations_per_entry = static_cast<double>(after.allocations - before.allocations) / num_entries;
+        }
+        before = AllocationCounter::Now();
+        result.hit_ns = MeasureNs_(lookup_keys_, [&](const key_type& key)
+        {
+            storage.GetValue(key);
+        });
+        after = AllocationCounter::Now();
+        result.allocations_per_hit = AllocationsPer_(before, after, lookup_keys_.size());
+
+        before = AllocationCounter::Now();
+        result.miss_ns = MeasureNs_(missing_keys_, [&](const key_type& key)
+        {
+            storage.Exists(key);
+        });
+        after = AllocationCounter::Now();
+        result.allocations_per_miss = AllocationsPer_(before, after, missing_keys_.size());
+
+        return result;
+    }
+
+private:
+    static KeyGenerator RandomKeys_(size_type key_length)
+    {
+        return [key_length](size_type count, std::mt19937& generator)
+        {
+            if constexpr (std::is_integral_v<key_type>)
+            {
+                std::uniform_int_distribution<key_type> distribution;
+                std::vector<key_type> keys(count);
+
+                std::generate(keys.begin(), keys.end(), [&]() { return distribution(generator); });
+                return keys;
+            }
+            else
+            {
+                return DataGenerator().GenerateNStrings(count, key_length);
+            }
+        };
+    }
+
+    static double AllocationsPer_(const AllocationCounter::Snapshot& before, const AllocationCounter::Snapshot& after, size_type count)
+    {
+        return count == 0 ? 0 : static_cast<double>(after.allocations - before.allocations) / static_cast<double>(count);
+    }
+
+    template<class Function>
+    static double MeasureNs_(const std::vector<key_type>& keys, Function function)
+    {
+        if (keys.empty())
+        {
+            return 0;
+        }
+
+        auto start_time = clock_type::now();
+        for (const auto& key : keys)
+        {
+            function(key);
+        }
+
+        return std::chrono::duration<double, std::nano>(clock_type::now() - start_time).count() / static_cast<double>(keys.size());
+    }
+
+private:
+    Timer<> timer_;
+    std::vector<key_type> keys_;
+    std::vector<key_type> lookup_keys_;
+    std::vector<key_type> missing_keys_;
+    mapped_type value_;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_RESEARCH_POINT_LOOKUP_RESEARCH_H_
@@ -0,0 +1,78 @@
+#ifndef TRANSACTIONS_INCLUDE_RESEARCH_REHASH_RESEARCH_H_
+#define TRANSACTIONS_INCLUDE_RESEARCH_REHASH_RESEARCH_H_
+
+#include <string>
+#include <vector>
+
+#include "common/storage_struct.h"
+#include "common/timer.h"
+#include "common/data_generator.h"
+
+namespace s21
+{
+
+/*
+Measures the cost of a full rehash, forced through Reserve, and of lookups for
+absent keys. Missing keys have the same length as stored ones, so comparisons
+cannot be rejected by size alone.
+*/
+template<class Storage>
+class RehashResearch
+{
+public:
+    using key_type = typename Storage::key_type;
+    using mapped_type = typename Storage::mapped_type;
+    using size_type = typename Storage::size_type;
+
+    struct Result
+    {
+        double fill_ms{ 0 };
+        double rehash_ms{ 0 };
+        double miss_ms{ 0 };
+    };
+
+public:
+    RehashResearch(size_type num_keys, size_type key_length)
+    {
+        keys_ = generator_.GenerateNStrings(num_keys, key_length);
+        missing_keys_ = generator_.GenerateNStrings(num_keys, key_length);
+        value_ = mapped_type{ "last_name", "first_name", 2000, "city", 100 };
+    }
+
+    Result Run(Storage& storage)
+    {
+        Result result;
+
+        result.fill_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : keys_)
+            {
+                storage.Insert(key, value_);
+            }
+        });
+        result.rehash_ms = timer_.MarkTime(1, [&]()
+        {
+            storage.Reserve(storage.Size() * 4);
+        });
+        result.miss_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : missing_keys_)
+            {
+                storage.Erase(key);
+            }
+        });
+
+        return result;
+    }
+
+private:
+    DataGenerator generator_;
+    Timer<> timer_;
+    std::vector<key_type> keys_;
+    std::vector<key_type> missing_keys_;
+    mapped_type value_;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_RESEARCH_REHASH_RESEARCH_H_
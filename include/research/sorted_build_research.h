@@ -0,0 +1,102 @@
+#ifndef TRANSACTIONS_INCLUDE_RESEARCH_SORTED_BUILD_RESEARCH_H_
+#define TRANSACTIONS_INCLUDE_RESEARCH_SORTED_BUILD_RESEARCH_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <algorithm>
+
+#include "common/storage_struct.h"
+#include "common/timer.h"
+#include "common/data_generator.h"
+
+namespace s21
+{
+
+struct SortedBuildResult
+{
+    double insert_ms{ 0 };
+    double bulk_load_ms{ 0 };
+    double copy_ms{ 0 };
+};
+
+/*
+Builds a tree from num_keys entries sorted by key, once by inserting them one by
+one and once through BulkLoad, and then copies the bulk loaded tree. Only the
+building and the copy are timed, not the copies of the entries handed over.
+*/
+template<class Tree>
+class SortedBuildResearch
+{
+public:
+    using key_type = typename Tree::key_type;
+    using mapped_type = typename Tree::mapped_type;
+    using size_type = typename Tree::size_type;
+    using Result = SortedBuildResult;
+
+    static constexpr size_type kKeyLength{ 16 };
+
+public:
+    explicit SortedBuildResearch(size_type num_keys)
+        : value_{ "last_name", "first_name", 2000, "city", 100 }
+    {
+        keys_ = generator_.GenerateNStrings(num_keys, kKeyLength);
+        std::sort(keys_.begin(), keys_.end());
+        keys_.erase(std::unique(keys_.begin(), keys_.end()), keys_.end());
+    }
+
+    Result Run()
+    {
+        Result result;
+
+        {
+            Tree tree;
+            result.insert_ms = timer_.MarkTime(1, [&]()
+            {
+                for (const auto& key : keys_)
+                {
+                    tree.Insert(key, value_);
+                }
+            });
+        }
+
+        Tree tree;
+        auto entries = Entries_();
+        result.bulk_load_ms = timer_.MarkTime(1, [&]()
+        {
+            tree.BulkLoad(std::move(entries));
+        });
+
+        std::optional<Tree> copy;
+        result.copy_ms = timer_.MarkTime(1, [&]()
+        {
+            copy.emplace(tree);
+        });
+
+        return result;
+    }
+
+private:
+    std::vector<std::pair<key_type, mapped_type>> Entries_() const
+    {
+        std::vector<std::pair<key_type, mapped_type>> entries;
+        entries.reserve(keys_.size());
+        for (const auto& key : keys_)
+        {
+            entries.emplace_back(key, value_);
+        }
+
+        return entries;
+    }
+
+private:
+    DataGenerator generator_;
+    Timer<> timer_;
+    std::vector<key_type> keys_;
+    mapped_type value_;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_RESEARCH_SORTED_BUILD_RESEARCH_H_
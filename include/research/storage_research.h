@@ -0,0 +1,94 @@
+#ifndef TRANSACTIONS_INCLUDE_RESEARCH_STORAGE_RESEARCH_H_
+#define TRANSACTIONS_INCLUDE_RESEARCH_STORAGE_RESEARCH_H_
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "common/storage_struct.h"
+#include "common/timer.h"
+#include "common/data_generator.h"
+
+namespace s21
+{
+
+/*
+Measures raw backend throughput, bypassing ContainerWrapper. The same key set is
+used for every backend passed to Run, so the results are directly comparable.
+*/
+template<class Storage>
+class StorageResearch
+{
+public:
+    using key_type = typename Storage::key_type;
+    using mapped_type = typename Storage::mapped_type;
+    using size_type = typename Storage::size_type;
+
+    struct Result
+    {
+        double insert_ms{ 0 };
+        double hit_ms{ 0 };
+        double miss_ms{ 0 };
+        double erase_ms{ 0 };
+    };
+
+public:
+    StorageResearch(size_type num_keys, size_type key_length)
+    {
+        keys_ = generator_.GenerateNStrings(num_keys, key_length);
+        missing_keys_ = generator_.GenerateNStrings(num_keys, key_length + 1);
+        lookup_keys_ = keys_;
+        std::shuffle(lookup_keys_.begin(), lookup_keys_.end(), std::mt19937{ std::random_device{}() });
+        value_ = mapped_type{ "last_name", "first_name", 2000, "city", 100 };
+    }
+
+    Result Run(Storage& storage)
+    {
+        Result result;
+
+        result.insert_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : keys_)
+            {
+                storage.Insert(key, value_);
+            }
+        });
+        result.hit_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : lookup_keys_)
+            {
+                storage.GetValue(key);
+            }
+        });
+        // Misses go through Erase so that exception handling in GetValue does not dominate.
+        result.miss_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : missing_keys_)
+            {
+                storage.Erase(key);
+            }
+        });
+        result.erase_ms = timer_.MarkTime(1, [&]()
+        {
+            for (const auto& key : lookup_keys_)
+            {
+                storage.Erase(key);
+            }
+        });
+
+        return result;
+    }
+
+private:
+    DataGenerator generator_;
+    Timer<> timer_;
+    std::vector<key_type> keys_;
+    std::vector<key_type> lookup_keys_;
+    std::vector<key_type> missing_keys_;
+    mapped_type value_;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_RESEARCH_STORAGE_RESEARCH_H_
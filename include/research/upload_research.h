@@ -0,0 +1,97 @@
+#ifndef TRANSACTIONS_INCLUDE_RESEARCH_UPLOAD_RESEARCH_H_
+#define TRANSACTIONS_INCLUDE_RESEARCH_UPLOAD_RESEARCH_H_
+
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <chrono>
+#include <algorithm>
+
+#include "common/allocation_counter.h"
+#include "common/data_generator.h"
+
+namespace s21
+{
+
+/*
+Measures Upload end to end: time and the number of heap allocations per loaded
+line. Value fields are longer than the small string buffer, so every copy of a
+record on the way into the storage shows up as extra allocations. A sorted file
+lets Upload build the storage with BulkLoad.
+*/
+template<class Wrapper>
+class UploadResearch
+{
+public:
+    using size_type = std::size_t;
+    using clock_type = std::chrono::steady_clock;
+
+    struct Result
+    {
+        double upload_ms{ 0 };
+        double allocations_per_line{ 0 };
+        double bytes_per_line{ 0 };
+    };
+
+public:
+    UploadResearch(size_type num_lines, size_type key_length, bool sorted = false)
+        : num_lines_(num_lines)
+        , path_(std::filesystem::temp_directory_path() / "transactions_upload_research.txt")
+    {
+        std::ofstream file(path_);
+        auto keys = generator_.GenerateNStrings(num_lines, key_length);
+
+        if (sorted)
+        {
+            std::sort(keys.begin(), keys.end());
+        }
+
+        for (const auto& key : keys)
+        {
+            file << key << " "
+                 << generator_.GenerateString(kFieldLength) << " "
+                 << generator_.GenerateString(kFieldLength) << " "
+                 << generator_.GenerateNumber(1900, 2020) << " "
+                 << generator_.GenerateString(kFieldLength) << " "
+                 << generator_.GenerateNumber(0, 1000) << "\n";
+        }
+    }
+
+    ~UploadResearch()
+    {
+        std::filesystem::remove(path_);
+    }
+
+    UploadResearch(const UploadResearch&) = delete;
+    UploadResearch& operator=(const UploadResearch&) = delete;
+
+    Result Run(Wrapper& wrapper)
+    {
+        Result result;
+
+        auto before = AllocationCounter::Now();
+        auto start_time = clock_type::now();
+        wrapper.Upload(path_);
+        result.upload_ms = std::chrono::duration<double, std::milli>(clock_type::now() - start_time).count();
+        auto after = AllocationCounter::Now();
+
+        if (num_lines_ > 0)
+        {
+            result.allocations_per_line = static_cast<double>(after.allocations - before.allocations) / static_cast<double>(num_lines_);
+            result.bytes_per_line = static_cast<double>(after.bytes - before.bytes) / static_cast<double>(num_lines_);
+        }
+
+        return result;
+    }
+
+private:
+    static constexpr size_type kFieldLength{ 20 };
+
+    DataGenerator generator_;
+    size_type num_lines_;
+    std::filesystem::path path_;
+};
+
+} // namespace s21
+
+#endif // TRANSACTIONS_INCLUDE_RESEARCH_UPLOAD_RESEARCH_H_
@@ -86,29 +86,35 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::Values(BPlusTreeTestParams{3})
 );
 
-//INSTANTIATE_TEST_SUITE_P(
-//        BPlusTreeOrder4,
-//        BPlusTreeSuite,
-//        ::testing::Values(BPlusTreeTestParams{4})
-//);
-//
-//INSTANTIATE_TEST_SUITE_P(
-//        BPlusTreeOrder5,
-//        BPlusTreeSuite,
-//        ::testing::Values(BPlusTreeTestParams{5})
-//);
-//
-//INSTANTIATE_TEST_SUITE_P(
-//        BPlusTreeOrder6,
-//        BPlusTreeSuite,
-//        ::testing::Values(BPlusTreeTestParams{6})
-//);
-//
-//INSTANTIATE_TEST_SUITE_P(
-//        BPlusTreeOrder7,
-//        BPlusTreeSuite,
-//        ::testing::Values(BPlusTreeTestParams{7})
-//);
+INSTANTIATE_TEST_SUITE_P(
+        BPlusTreeOrder4,
+        BPlusTreeSuite,
+        ::testing::Values(BPlusTreeTestParams{4})
+);
+
+INSTANTIATE_TEST_SUITE_P(
+        BPlusTreeOrder5,
+        BPlusTreeSuite,
+        ::testing::Values(BPlusTreeTestParams{5})
+);
+
+INSTANTIATE_TEST_SUITE_P(
+        BPlusTreeOrder6,
+        BPlusTreeSuite,
+        ::testing::Values(BPlusTreeTestParams{6})
+);
+
+INSTANTIATE_TEST_SUITE_P(
+        BPlusTreeOrder7,
+        BPlusTreeSuite,
+        ::testing::Values(BPlusTreeTestParams{7})
+);
+
+INSTANTIATE_TEST_SUITE_P(
+        BPlusTreeDefaultOrder,
+        BPlusTreeSuite,
+        ::testing::Values(BPlusTreeTestParams{ BPlusTree<std::string>::kDefaultOrder })
+);
 
 } // namespace Test
 
@@ -0,0 +1,48 @@
+#ifndef TRANSACTIONS_INCLUDE_TESTS_TEST_CONCURRENT_B_PLUS_TREE_H_
+#define TRANSACTIONS_INCLUDE_TESTS_TEST_CONCURRENT_B_PLUS_TREE_H_
+
+#include "test_core.h"
+#include "bpt/concurrent_b_plus_tree.h"
+
+namespace Test
+{
+
+struct ConcurrentBPlusTreeParams
+{
+    std::size_t order;
+    std::size_t num_keys;
+    std::size_t num_threads;
+};
+
+class ConcurrentBPlusTreeSuite : public ::testing::TestWithParam<ConcurrentBPlusTreeParams>
+{
+protected:
+    void SetUp() override
+    {
+        tree = new ConcurrentBPlusTree<std::string>(GetParam().order);
+    }
+
+    void TearDown() override
+    {
+        delete tree;
+    }
+
+protected:
+    ConcurrentBPlusTree<std::string>* tree{ nullptr };
+};
+
+INSTANTIATE_TEST_SUITE_P(
+        ConcurrentBPlusTreeOneThread,
+        ConcurrentBPlusTreeSuite,
+        ::testing::Values(ConcurrentBPlusTreeParams{3, 1000, 1}, ConcurrentBPlusTreeParams{32, 1000, 1})
+);
+
+INSTANTIATE_TEST_SUITE_P(
+        ConcurrentBPlusTreeManyThreads,
+        ConcurrentBPlusTreeSuite,
+        ::testing::Values(ConcurrentBPlusTreeParams{4, 5000, 8}, ConcurrentBPlusTreeParams{32, 10000, 8})
+);
+
+} // namespace Test
+
+#endif // TRANSACTIONS_INCLUDE_TESTS_TEST_CONCURRENT_B_PLUS_TREE_H_
@@ -0,0 +1,47 @@
+#ifndef TRANSACTIONS_INCLUDE_TESTS_TEST_CONCURRENT_HASH_TABLE_H_
+#define TRANSACTIONS_INCLUDE_TESTS_TEST_CONCURRENT_HASH_TABLE_H_
+
+#include "test_core.h"
+#include "hash_table/concurrent_hash_table.h"
+
+namespace Test
+{
+
+struct ConcurrentHashTableParams
+{
+    std::size_t num_keys;
+    std::size_t num_threads;
+};
+
+class ConcurrentHashTableSuite : public ::testing::TestWithParam<ConcurrentHashTableParams>
+{
+protected:
+    void SetUp() override
+    {
+        hash_table = new ConcurrentHashTable<std::string>();
+    }
+
+    void TearDown() override
+    {
+        delete hash_table;
+    }
+
+protected:
+    ConcurrentHashTable<std::string>* hash_table{ nullptr };
+};
+
+INSTANTIATE_TEST_SUITE_P(
+        ConcurrentHashTableOneThread,
+        ConcurrentHashTableSuite,
+        ::testing::Values(ConcurrentHashTableParams{1000, 1})
+);
+
+INSTANTIATE_TEST_SUITE_P(
+        ConcurrentHashTableManyThreads,
+        ConcurrentHashTableSuite,
+        ::testing::Values(ConcurrentHashTableParams{10000, 8})
+);
+
+} // namespace Test
+
+#endif // TRANSACTIONS_INCLUDE_TESTS_TEST_CONCURRENT_HASH_TABLE_H_
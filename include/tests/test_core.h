@@ -2,6 +2,9 @@
 #define TRANSACTIONS_INCLUDE_TESTS_TEST_CORE_H_
 
 #include <gtest/gtest.h>
+#include <iterator>
+#include <set>
+#include <string>
 #include "common/storage_struct.h"
 
 namespace Test
@@ -12,6 +15,33 @@ using namespace s21;
 static const Value value1 = {"last_name", "first_name", 2000, "city", 183};
 static const Value value2 = {"abcdef", "defabc", 1900, "Moscow", 99};
 
+// Compares Rank, Select and CountRange of an ordered storage with the keys it should hold.
+template<class Storage>
+void CheckOrderStatistics(Storage& storage, const std::set<std::string>& keys)
+{
+    const std::string middle = "key5";
+    auto not_greater_than_middle = static_cast<std::size_t>(std::distance(keys.begin(), keys.upper_bound(middle)));
+    std::vector<std::string> probes(keys.begin(), keys.end());
+    probes.insert(probes.end(), { "", "a", "key", middle, "key55", "z" });
+
+    for (const auto& probe : probes)
+    {
+        auto lower = static_cast<std::size_t>(std::distance(keys.begin(), keys.lower_bound(probe)));
+        auto upper = static_cast<std::size_t>(std::distance(keys.begin(), keys.upper_bound(probe)));
+
+        EXPECT_EQ(storage.Rank(probe), lower);
+        EXPECT_EQ(storage.CountRange(probe, probe), upper - lower);
+        EXPECT_EQ(storage.CountRange(probe, middle), probe <= middle ? not_greater_than_middle - lower : 0);
+    }
+
+    std::size_t index = 0;
+    for (const auto& key : keys)
+    {
+        EXPECT_EQ(storage.Select(index++).first, key);
+    }
+    EXPECT_THROW(storage.Select(keys.size()), std::out_of_range);
+}
+
 } // namespace Test
 
 #endif // TRANSACTIONS_INCLUDE_TESTS_TEST_CORE_H_
@@ -0,0 +1,46 @@
+#ifndef TRANSACTIONS_INCLUDE_TESTS_TEST_FLAT_HASH_TABLE_H_
+#define TRANSACTIONS_INCLUDE_TESTS_TEST_FLAT_HASH_TABLE_H_
+
+#include "test_core.h"
+#include "hash_table/flat_hash_table.h"
+
+namespace Test
+{
+
+struct FlatHashTableParams
+{
+    std::size_t num_keys;
+};
+
+class FlatHashTableSuite : public ::testing::TestWithParam<FlatHashTableParams>
+{
+protected:
+    void SetUp() override
+    {
+        hash_table = new FlatHashTable<std::string>();
+    }
+
+    void TearDown() override
+    {
+        delete hash_table;
+    }
+
+protected:
+    FlatHashTable<std::string>* hash_table{ nullptr };
+};
+
+INSTANTIATE_TEST_SUITE_P(
+        FlatHashTableOneGroup,
+        FlatHashTableSuite,
+        ::testing::Values(FlatHashTableParams{10})
+);
+
+INSTANTIATE_TEST_SUITE_P(
+        FlatHashTableManyGroups,
+        FlatHashTableSuite,
+        ::testing::Values(FlatHashTableParams{10000})
+);
+
+} // namespace Test
+
+#endif // TRANSACTIONS_INCLUDE_TESTS_TEST_FLAT_HASH_TABLE_H_
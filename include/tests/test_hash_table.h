@@ -3,12 +3,14 @@
 
 #include "test_core.h"
 #include "hash_table/hash_table.h"
+#include "hash_table/hashers.h"
 
 namespace Test
 {
 
 struct HashTableParams
 {
+    RehashPolicy policy{ RehashPolicy::kImmediate };
     std::vector<std::pair<std::string, Value>> std_dataset_identical_values{
             {"snail", value1},
             {"youth", value1},
@@ -60,7 +62,7 @@ class HashTableSuite : public ::testing::TestWithParam<HashTableParams>
 protected:
     void SetUp() override
     {
-        hash_table = new HashTable<std::string>();
+        hash_table = new HashTable<std::string>(GetParam().policy);
     }
 
     void TearDown() override
@@ -78,6 +80,12 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::Values(HashTableParams{})
 );
 
+INSTANTIATE_TEST_SUITE_P(
+        HashTableIncremental,
+        HashTableSuite,
+        ::testing::Values(HashTableParams{RehashPolicy::kIncremental})
+);
+
 } // namespace Test
 
 #endif // TRANSACTIONS_INCLUDE_TESTS_TEST_HASH_TABLE_H_
@@ -0,0 +1,47 @@
+#ifndef TRANSACTIONS_INCLUDE_TESTS_TEST_LOCK_FREE_READ_HASH_TABLE_H_
+#define TRANSACTIONS_INCLUDE_TESTS_TEST_LOCK_FREE_READ_HASH_TABLE_H_
+
+#include "test_core.h"
+#include "hash_table/lock_free_read_hash_table.h"
+
+namespace Test
+{
+
+struct LockFreeReadHashTableParams
+{
+    std::size_t num_keys;
+    std::size_t num_threads;
+};
+
+class LockFreeReadHashTableSuite : public ::testing::TestWithParam<LockFreeReadHashTableParams>
+{
+protected:
+    void SetUp() override
+    {
+        hash_table = new LockFreeReadHashTable<std::string>();
+    }
+
+    void TearDown() override
+    {
+        delete hash_table;
+    }
+
+protected:
+    LockFreeReadHashTable<std::string>* hash_table{ nullptr };
+};
+
+INSTANTIATE_TEST_SUITE_P(
+        LockFreeReadHashTableOneThread,
+        LockFreeReadHashTableSuite,
+        ::testing::Values(LockFreeReadHashTableParams{1000, 1})
+);
+
+INSTANTIATE_TEST_SUITE_P(
+        LockFreeReadHashTableManyThreads,
+        LockFreeReadHashTableSuite,
+        ::testing::Values(LockFreeReadHashTableParams{10000, 8})
+);
+
+} // namespace Test
+
+#endif // TRANSACTIONS_INCLUDE_TESTS_TEST_LOCK_FREE_READ_HASH_TABLE_H_
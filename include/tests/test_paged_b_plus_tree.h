@@ -0,0 +1,71 @@
+#ifndef TRANSACTIONS_INCLUDE_TESTS_TEST_PAGED_B_PLUS_TREE_H_
+#define TRANSACTIONS_INCLUDE_TESTS_TEST_PAGED_B_PLUS_TREE_H_
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include "test_core.h"
+#include "bpt/paged_b_plus_tree.h"
+
+namespace Test
+{
+
+struct PagedBPlusTreeParams
+{
+    std::size_t page_size;
+    std::size_t pool_pages;
+    std::size_t num_keys;
+};
+
+// Every test gets its own file in the temporary directory, named after the test.
+inline std::filesystem::path PagedBPlusTreeTestPath()
+{
+    auto info = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::string name = std::string(info->test_suite_name()) + "." + info->name() + ".pages";
+
+    std::replace(name.begin(), name.end(), '/', '_');
+    return std::filesystem::temp_directory_path() / name;
+}
+
+class PagedBPlusTreeSuite : public ::testing::TestWithParam<PagedBPlusTreeParams>
+{
+protected:
+    void SetUp() override
+    {
+        path = PagedBPlusTreeTestPath();
+        std::filesystem::remove(path);
+        tree = Open();
+    }
+
+    void TearDown() override
+    {
+        delete tree;
+        std::filesystem::remove(path);
+    }
+
+    PagedBPlusTree<std::string>* Open()
+    {
+        return new PagedBPlusTree<std::string>(path, GetParam().pool_pages, GetParam().page_size);
+    }
+
+protected:
+    std::filesystem::path path;
+    PagedBPlusTree<std::string>* tree{ nullptr };
+};
+
+INSTANTIATE_TEST_SUITE_P(
+        PagedBPlusTreeSmallPool,
+        PagedBPlusTreeSuite,
+        ::testing::Values(PagedBPlusTreeParams{256, 8, 3000}, PagedBPlusTreeParams{4096, 8, 5000})
+);
+
+INSTANTIATE_TEST_SUITE_P(
+        PagedBPlusTreeLargePool,
+        PagedBPlusTreeSuite,
+        ::testing::Values(PagedBPlusTreeParams{4096, 256, 5000})
+);
+
+} // namespace Test
+
+#endif // TRANSACTIONS_INCLUDE_TESTS_TEST_PAGED_B_PLUS_TREE_H_
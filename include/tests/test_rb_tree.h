@@ -3,6 +3,8 @@
 
 #include "test_core.h"
 #include "rbtree/rbtree.h"
+#include "rbtree/kvtree.h"
+#include "common/pool_allocator.h"
 
 namespace Test
 {
@@ -0,0 +1,22 @@
+#ifndef TRANSACTIONS_INCLUDE_TESTS_TEST_SLAB_ARENA_H_
+#define TRANSACTIONS_INCLUDE_TESTS_TEST_SLAB_ARENA_H_
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "test_core.h"
+#include "common/slab_arena.h"
+
+namespace Test
+{
+
+// Tells whether a block starts on a multiple of alignment.
+inline bool IsAligned(const void* block, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(block) % alignment == 0;
+}
+
+} // namespace Test
+
+#endif // TRANSACTIONS_INCLUDE_TESTS_TEST_SLAB_ARENA_H_
@@ -1,12 +1,13 @@
 #ifndef TRANSACTIONS_INCLUDE_WRAPPER_CONTAINER_WRAPPER_H_
 #define TRANSACTIONS_INCLUDE_WRAPPER_CONTAINER_WRAPPER_H_
 
-#include <unordered_map>
+#include <map>
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <iterator>
 
-#include "common/storage_interface.h"
+#include "common/ordered_storage_interface.h"
 #include "common/timer.h"
 
 namespace s21
@@ -19,31 +20,46 @@ public:
     using key_type = typename Container::key_type;
     using mapped_type = typename Container::mapped_type;
     using size_type = typename Container::size_type;
+    using key_view_type = typename Container::key_view_type;
 
 public:
     ContainerWrapper();
     explicit ContainerWrapper(Container* container);
 
-    bool Insert(const key_type& key, const mapped_type& value, int64_t life_time);
-    mapped_type GetValue(const key_type& key);
-    bool Exists(const key_type& key);
-    bool Erase(const key_type& key);
+    bool Insert(key_type key, mapped_type value, int64_t life_time);
+    mapped_type GetValue(key_view_type key);
+    bool Exists(key_view_type key);
+    bool Erase(key_view_type key);
     bool Update(const key_type& key, const mapped_type& value);
     std::vector<key_type> Keys();
     bool Rename(const key_type& current_key, const key_type& new_key);
-    size_type TTL(const key_type& key);
+    size_type TTL(key_view_type key);
     std::vector<key_type> Find(const mapped_type& value);
     std::vector<mapped_type> ShowAll();
     size_type Upload(const std::filesystem::path& path);
     size_type Export(const std::filesystem::path& path);
+    // Only for storages with ordered keys, others throw std::runtime_error.
+    std::vector<std::pair<key_type, mapped_type>> RangeScan(key_view_type lower, key_view_type upper, size_type limit = 0);
+    std::vector<std::pair<key_type, mapped_type>> PrefixScan(key_view_type prefix, size_type limit = 0);
+    size_type Rank(key_view_type key);
+    std::pair<key_type, mapped_type> Select(size_type index);
+    size_type CountRange(key_view_type lower, key_view_type upper);
 
 private:
-    bool RemoveIfExpired(const key_type& key);
+    bool RemoveIfExpired(key_view_type key);
     void RemoveAllExpired();
+    template<class Function>
+    void ForEach(Function function);
+    OrderedKeyValueStorageInterface<key_type, mapped_type>& Ordered();
 
 private:
+    // Entries are visited through Scan in batches of this size, so walking the
+    // whole storage never copies more than one batch at a time.
+    static constexpr size_type kScanBatchSize{ 1024 };
+
     std::unique_ptr<Container> container_;
-    std::unordered_map<key_type, Timer<>> timer_storage_;
+    // std::less<> makes the lookups transparent, so a key view can be searched for directly.
+    std::map<key_type, Timer<>, std::less<>> timer_storage_;
 };
 
 } // namespace s21
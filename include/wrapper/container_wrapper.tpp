@@ -17,15 +17,19 @@ ContainerWrapper<Container>::ContainerWrapper(Container* container)
 {}
 
 template<class Container>
-bool ContainerWrapper<Container>::Insert(const key_type& key, const mapped_type& value, int64_t life_time)
+bool ContainerWrapper<Container>::Insert(key_type key, mapped_type value, int64_t life_time)
 {
     RemoveIfExpired(key);
-    auto result = container_->Insert(key, value);
 
-    if (result && life_time > 0)
+    if (life_time <= 0)
     {
-        timer_storage_.emplace(key, life_time);
-        timer_storage_.at(key).Start();
+        return container_->Insert(std::move(key), std::move(value));
+    }
+
+    auto result = container_->Insert(key, std::move(value));
+    if (result)
+    {
+        timer_storage_.emplace(std::move(key), life_time).first->second.Start();
     }
 
     return result;
@@ -33,31 +37,21 @@ bool ContainerWrapper<Container>::Insert(const key_type& key, const mapped_type&
 
 
 template<class Container>
-typename ContainerWrapper<Container>::mapped_type ContainerWrapper<Container>::GetValue(const key_type& key)
+typename ContainerWrapper<Container>::mapped_type ContainerWrapper<Container>::GetValue(key_view_type key)
 {
     RemoveIfExpired(key);
     return container_->GetValue(key);
 }
 
 template<class Container>
-bool ContainerWrapper<Container>::Exists(const key_type& key)
+bool ContainerWrapper<Container>::Exists(key_view_type key)
 {
     RemoveIfExpired(key);
-
-    try
-    {
-        container_->GetValue(key);
-    }
-    catch (const std::runtime_error& e)
-    {
-        return false;
-    }
-
-    return true;
+    return container_->Exists(key);
 }
 
 template<class Container>
-bool ContainerWrapper<Container>::Erase(const key_type& key)
+bool ContainerWrapper<Container>::Erase(key_view_type key)
 {
     if (auto it = timer_storage_.find(key); it != timer_storage_.end())
     {
@@ -100,10 +94,11 @@ std::vector<typename ContainerWrapper<Container>::key_type> ContainerWrapper<Con
     RemoveAllExpired();
     std::vector<key_type> keys;
 
-    for (const auto& [key, value] : container_->ShowAll())
+    keys.reserve(container_->Size());
+    ForEach([&keys](key_type& key, mapped_type&)
     {
-        keys.push_back(key);
-    }
+        keys.push_back(std::move(key));
+    });
 
     return keys;
 }
@@ -122,7 +117,7 @@ bool ContainerWrapper<Container>::Rename(const key_type& current_key, const key_
             {
                 auto value = container_->GetValue(current_key);
                 container_->Erase(current_key);
-                container_->Insert(new_key, value);
+                container_->Insert(new_key, std::move(value));
 
                 auto timer_it = timer_storage_.find(current_key);
                 if (timer_it != timer_storage_.end())
@@ -145,7 +140,7 @@ bool ContainerWrapper<Container>::Rename(const key_type& current_key, const key_
 }
 
 template<class Container>
-typename ContainerWrapper<Container>::size_type ContainerWrapper<Container>::TTL(const key_type& key)
+typename ContainerWrapper<Container>::size_type ContainerWrapper<Container>::TTL(key_view_type key)
 {
     RemoveIfExpired(key);
 
@@ -167,13 +162,13 @@ std::vector<typename ContainerWrapper<Container>::key_type> ContainerWrapper<Con
     RemoveAllExpired();
     std::vector<key_type> keys;
 
-    for (const auto& kv : container_->ShowAll())
+    ForEach([&keys, &value](key_type& key, mapped_type& entry_value)
     {
-        if (kv.second == value)
+        if (entry_value == value)
         {
-            keys.push_back(kv.first);
+            keys.push_back(std::move(key));
         }
-    }
+    });
 
     return keys;
 }
@@ -184,10 +179,11 @@ std::vector<typename ContainerWrapper<Container>::mapped_type> ContainerWrapper<
     RemoveAllExpired();
     std::vector<mapped_type> values;
 
-    for (const auto& [key, value] : container_->ShowAll())
+    values.reserve(container_->Size());
+    ForEach([&values](key_type&, mapped_type& value)
     {
-        values.push_back(value);
-    }
+        values.push_back(std::move(value));
+    });
 
     return values;
 }
@@ -207,8 +203,19 @@ typename ContainerWrapper<Container>::size_type ContainerWrapper<Container>::Upl
         throw std::runtime_error("Unable to open the file.");
     }
 
+    auto num_lines = std::count(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>(), '\n');
+    container_->Reserve(container_->Size() + num_lines);
+    file.clear();
+    file.seekg(0);
+
     size_type num_entries = 0;
     std::string line;
+    // While the file is sorted by key and the storage was empty, the entries are
+    // collected and handed to BulkLoad at the end. The first out of order key sends
+    // them through Insert, and so does every line after it.
+    bool sorted = (container_->Size() == 0);
+    std::vector<std::pair<key_type, mapped_type>> sorted_entries;
+    std::vector<size_type> life_times;
 
     while (std::getline(file, line))
     {
@@ -230,12 +237,54 @@ typename ContainerWrapper<Container>::size_type ContainerWrapper<Container>::Upl
             continue;
         }
 
-        if (!iss.fail() && Insert(key, value, life_time))
+        if (iss.fail())
+        {
+            continue;
+        }
+
+        if (sorted && (sorted_entries.empty() || sorted_entries.back().first < key))
+        {
+            sorted_entries.emplace_back(std::move(key), std::move(value));
+            life_times.push_back(life_time);
+            continue;
+        }
+
+        if (sorted)
+        {
+            sorted = false;
+            for (size_type i = 0; i < sorted_entries.size(); ++i)
+            {
+                num_entries += Insert(std::move(sorted_entries[i].first), std::move(sorted_entries[i].second), life_times[i]);
+            }
+            sorted_entries.clear();
+            sorted_entries.shrink_to_fit();
+        }
+
+        if (Insert(std::move(key), std::move(value), life_time))
         {
             ++num_entries;
         }
     }
 
+    if (sorted)
+    {
+        std::vector<std::pair<key_type, size_type>> timers;
+
+        for (size_type i = 0; i < sorted_entries.size(); ++i)
+        {
+            if (life_times[i] > 0)
+            {
+                timers.emplace_back(sorted_entries[i].first, life_times[i]);
+            }
+        }
+
+        num_entries += container_->BulkLoad(std::move(sorted_entries));
+        for (auto& [key, life_time] : timers)
+        {
+            timer_storage_.emplace(std::move(key), life_time).first->second.Start();
+        }
+    }
+
     return num_entries;
 }
 
@@ -256,30 +305,75 @@ typename ContainerWrapper<Container>::size_type ContainerWrapper<Container>::Exp
 
     size_type num_entries = 0;
 
-    for (const auto& [key, value] : container_->ShowAll())
+    // The storage is not modified during the scan: keys that expire while it runs are
+    // skipped here and removed on their next access.
+    RemoveAllExpired();
+    ForEach([this, &file, &num_entries](key_type& key, mapped_type& value)
     {
-        if (!RemoveIfExpired(key))
+        auto it = timer_storage_.find(key);
+
+        if (it != timer_storage_.end() && it->second.IsExpired())
         {
-            ++num_entries;
-            file << key << " " << value;
-            if (auto it = timer_storage_.find(key); it != timer_storage_.end())
-            {
-                file << " " << it->second.GetRemainingTime();
-            }
-            file << std::endl;
+            return;
         }
-    }
+
+        ++num_entries;
+        file << key << " " << value;
+        if (it != timer_storage_.end())
+        {
+            file << " " << it->second.GetRemainingTime();
+        }
+        file << std::endl;
+    });
 
     return num_entries;
 }
 
 template<class Container>
-bool ContainerWrapper<Container>::RemoveIfExpired(const key_type& key)
+std::vector<std::pair<typename ContainerWrapper<Container>::key_type, typename ContainerWrapper<Container>::mapped_type>>
+ContainerWrapper<Container>::RangeScan(key_view_type lower, key_view_type upper, size_type limit)
+{
+    RemoveAllExpired();
+    return Ordered().RangeScan(lower, upper, limit);
+}
+
+template<class Container>
+std::vector<std::pair<typename ContainerWrapper<Container>::key_type, typename ContainerWrapper<Container>::mapped_type>>
+ContainerWrapper<Container>::PrefixScan(key_view_type prefix, size_type limit)
+{
+    RemoveAllExpired();
+    return Ordered().PrefixScan(prefix, limit);
+}
+
+template<class Container>
+typename ContainerWrapper<Container>::size_type ContainerWrapper<Container>::Rank(key_view_type key)
+{
+    RemoveAllExpired();
+    return Ordered().Rank(key);
+}
+
+template<class Container>
+std::pair<typename ContainerWrapper<Container>::key_type, typename ContainerWrapper<Container>::mapped_type>
+ContainerWrapper<Container>::Select(size_type index)
+{
+    RemoveAllExpired();
+    return Ordered().Select(index);
+}
+
+template<class Container>
+typename ContainerWrapper<Container>::size_type ContainerWrapper<Container>::CountRange(key_view_type lower, key_view_type upper)
+{
+    RemoveAllExpired();
+    return Ordered().CountRange(lower, upper);
+}
+
+template<class Container>
+bool ContainerWrapper<Container>::RemoveIfExpired(key_view_type key)
 {
     if (auto it = timer_storage_.find(key); it != timer_storage_.end() && it->second.IsExpired())
     {
-        timer_storage_.erase(it);
         container_->Erase(key);
+        timer_storage_.erase(it);
         return true;
     }
 
@@ -302,7 +396,39 @@ void ContainerWrapper<Container>::RemoveAllExpired()
         }
     }
 }
-    
+
+template<class Container>
+OrderedKeyValueStorageInterface<typename ContainerWrapper<Container>::key_type, typename ContainerWrapper<Container>::mapped_type>&
+ContainerWrapper<Container>::Ordered()
+{
+    auto ordered = dynamic_cast<OrderedKeyValueStorageInterface<key_type, mapped_type>*>(container_.get());
+
+    if (!ordered)
+    {
+        throw std::runtime_error("The storage does not keep its keys ordered.");
+    }
+
+    return *ordered;
+}
+
+template<class Container>
+template<class Function>
+void ContainerWrapper<Container>::ForEach(Function function)
+{
+    typename Container::ScanCursor cursor;
+
+    do
+    {
+        auto batch = container_->Scan(cursor, kScanBatchSize);
+
+        for (auto& [key, value] : batch.entries)
+        {
+            function(key, value);
+        }
+        cursor = std::move(batch.cursor);
+    } while (!cursor.finished);
+}
+
 } // namespace s21
 
 #endif // TRANSACTIONS_INCLUDE_WRAPPER_CONTAINER_WRAPPER_TPP_
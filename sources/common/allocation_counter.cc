@@ -0,0 +1,98 @@
+#include "common/allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <malloc.h>
+#include <new>
+
+namespace s21
+{
+
+namespace
+{
+
+std::atomic<AllocationCounter::size_type> num_allocations{ 0 };
+std::atomic<AllocationCounter::size_type> num_bytes{ 0 };
+std::atomic<AllocationCounter::size_type> num_live_bytes{ 0 };
+
+} // namespace
+
+AllocationCounter::Snapshot AllocationCounter::Now() noexcept
+{
+    return { num_allocations.load(std::memory_order_relaxed), num_bytes.load(std::memory_order_relaxed),
+             num_live_bytes.load(std::memory_order_relaxed) };
+}
+
+void AllocationCounter::Record(size_type bytes) noexcept
+{
+    num_allocations.fetch_add(1, std::memory_order_relaxed);
+    num_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+// The usable size is what free gives back, so it is counted on both sides.
+void AllocationCounter::RecordLive(void* pointer) noexcept
+{
+    num_live_bytes.fetch_add(malloc_usable_size(pointer), std::memory_order_relaxed);
+}
+
+void AllocationCounter::ReleaseLive(void* pointer) noexcept
+{
+    if (pointer != nullptr)
+    {
+        num_live_bytes.fetch_sub(malloc_usable_size(pointer), std::memory_order_relaxed);
+    }
+}
+
+} // namespace s21
+
+// The array and nothrow forms of new and delete, aligned or not, forward to these by default.
+void* operator new(std::size_t size)
+{
+    s21::AllocationCounter::Record(size);
+
+    if (auto pointer = std::malloc(size ? size : 1); pointer)
+    {
+        s21::AllocationCounter::RecordLive(pointer);
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    s21::AllocationCounter::ReleaseLive(pointer);
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, [[maybe_unused]] std::size_t size) noexcept
+{
+    s21::AllocationCounter::ReleaseLive(pointer);
+    std::free(pointer);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    s21::AllocationCounter::Record(size);
+
+    auto align = static_cast<std::size_t>(alignment);
+    if (auto pointer = std::aligned_alloc(align, (size + align - 1) / align * align); pointer)
+    {
+        s21::AllocationCounter::RecordLive(pointer);
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer, [[maybe_unused]] std::align_val_t alignment) noexcept
+{
+    s21::AllocationCounter::ReleaseLive(pointer);
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, [[maybe_unused]] std::size_t size, [[maybe_unused]] std::align_val_t alignment) noexcept
+{
+    s21::AllocationCounter::ReleaseLive(pointer);
+    std::free(pointer);
+}
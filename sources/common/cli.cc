@@ -58,7 +58,10 @@ bool CLI::MainSelector_()
                 }
                 break;
             case 3:
-                Research_();
+                while (Research_())
+                {
+                    CleanInputStream_();
+                };
                 break;
             case 0:
                 return false;
@@ -82,6 +85,10 @@ bool CLI::SelectStorageType_()
         std::cout << "\t1. Hash table\n"
                      "\t2. Self-balancing binary search tree\n"
                      "\t3. B+ tree\n"
+                     "\t4. Open addressing hash table\n"
+                     "\t5. Concurrent hash table\n"
+                     "\t6. Lock-free read hash table\n"
+                     "\t7. Concurrent B+ tree\n"
                      "\t0. Back\n"
                      ">> ";
         std::cin >> chooser;
@@ -92,14 +99,31 @@ bool CLI::SelectStorageType_()
     switch (GetStorageTypeSelection())
     {
         case 1:
-            storage_ = std::make_unique<wrapper_type>(new hash_table);
-            return false;
+            if (auto table = CreateHashTable_(); table)
+            {
+                storage_ = std::make_unique<wrapper_type>(table);
+                return false;
+            }
+            std::cout << "\tTry again...\n";
+            break;
         case 2:
             storage_ = std::make_unique<wrapper_type>(new rb_tree);
             return false;
         case 3:
             storage_ = std::make_unique<wrapper_type>(new b_plus_tree);
             return false;
+        case 4:
+            storage_ = std::make_unique<wrapper_type>(new flat_hash_table);
+            return false;
+        case 5:
+            storage_ = std::make_unique<wrapper_type>(new concurrent_hash_table);
+            return false;
+        case 6:
+            storage_ = std::make_unique<wrapper_type>(new lock_free_read_hash_table);
+            return false;
+        case 7:
+            storage_ = std::make_unique<wrapper_type>(new concurrent_b_plus_tree);
+            return false;
         case 0:
             return false;
         default:
@@ -109,6 +133,28 @@ bool CLI::SelectStorageType_()
     return true;
 }
 
+CLI::storage_type* CLI::CreateHashTable_()
+{
+    int chooser = 0;
+    std::cout << "\t1. std::hash\n"
+                 "\t2. wyhash\n"
+                 "\t3. xxh3-style hash\n"
+                 ">> ";
+    std::cin >> chooser;
+
+    switch (std::cin.fail() ? -1 : chooser)
+    {
+        case 1:
+            return new hash_table;
+        case 2:
+            return new wyhash_table;
+        case 3:
+            return new xxh3_table;
+        default:
+            return nullptr;
+    }
+}
+
 bool CLI::SelectFunction_()
 {
     static const auto GetStorageFunctionSelection = []()
@@ -125,6 +171,8 @@ bool CLI::SelectFunction_()
                      "\tTTL <key>\n"
                      "\tFIND <last_name> <first_name> <year> <city> <coins>\n"
                      "\tSHOWALL\n"
+                     "\tRANGE <first_key> <last_key> [<limit>]\n"
+                     "\tCOUNT <first_key> <last_key>\n"
                      "\tUPLOAD <path/to/file>\n"
                      "\tEXPORT <path/to/file>\n"
                      "0. Back\n"
@@ -154,7 +202,98 @@ bool CLI::SelectFunction_()
     return true;
 }
 
-void CLI::Research_()
+bool CLI::Research_()
+{
+    static const auto GetResearchSelection = []()
+    {
+        int chooser = 0;
+        std::cout << "\t1. Storage types\n"
+                     "\t2. Hash table engines\n"
+                     "\t3. Hash table insert latency\n"
+                     "\t4. Hash table rehash and misses\n"
+                     "\t5. Concurrent hash table scaling\n"
+                     "\t6. Concurrent hash table reader/writer mix\n"
+                     "\t7. Hash functions\n"
+                     "\t8. Upload time and allocations\n"
+                     "\t9. Point lookups and bytes per entry\n"
+                     "\t10. B+ tree node search\n"
+                     "\t11. B+ tree key compression\n"
+                     "\t12. Concurrent B+ tree reader/writer mix\n"
+                     "\t13. Paged B+ tree buffer pool\n"
+                     "\t14. Insert/erase churn\n"
+                     "\t15. B+ tree erase/reinsert cycles\n"
+                     "\t16. RB tree batch updates\n"
+                     "\t17. RB tree build from sorted entries\n"
+                     "\t0. Back\n"
+                     ">> ";
+        std::cin >> chooser;
+
+        return std::cin.fail() ? -1 : chooser;
+    };
+
+    switch (GetResearchSelection())
+    {
+        case 1:
+            StorageTypesResearch_();
+            return false;
+        case 2:
+            HashTableEnginesResearch_();
+            return false;
+        case 3:
+            InsertLatencyResearch_();
+            return false;
+        case 4:
+            RehashResearch_();
+            return false;
+        case 5:
+            ConcurrencyResearch_();
+            return false;
+        case 6:
+            ReadWriteMixResearch_();
+            return false;
+        case 7:
+            HashQualityResearch_();
+            return false;
+        case 8:
+            UploadResearch_();
+            return false;
+        case 9:
+            PointLookupResearch_();
+            return false;
+        case 10:
+            NodeSearchResearch_();
+            return false;
+        case 11:
+            KeyCompressionResearch_();
+            return false;
+        case 12:
+            ConcurrentBPlusTreeResearch_();
+            return false;
+        case 13:
+            PagedBPlusTreeResearch_();
+            return false;
+        case 14:
+            ChurnResearch_();
+            return false;
+        case 15:
+            EraseCycleResearch_();
+            return false;
+        case 16:
+            BatchUpdateResearch_();
+            return false;
+        case 17:
+            SortedBuildResearch_();
+            return false;
+        case 0:
+            return false;
+        default:
+            std::cout << "\tTry again...\n";
+    }
+
+    return true;
+}
+
+void CLI::StorageTypesResearch_()
 {
     std::size_t starting_num_elements;
     std::size_t num_times;
@@ -180,4 +319,623 @@ void CLI::Research_()
     }
 }
 
+void CLI::HashTableEnginesResearch_()
+{
+    std::size_t num_keys;
+    std::size_t key_length;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the key length." << std::endl;
+    std::cin >> key_length;
+
+    if (!std::cin.fail())
+    {
+        StorageResearch<storage_type> research(num_keys, key_length);
+        hash_table ht;
+        flat_hash_table fht;
+
+        PrintStorageResearch_("HashTable", research.Run(ht));
+        PrintStorageResearch_("FlatHashTable", research.Run(fht));
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::InsertLatencyResearch_()
+{
+    std::size_t num_keys;
+    std::size_t key_length;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the key length." << std::endl;
+    std::cin >> key_length;
+
+    if (!std::cin.fail())
+    {
+        InsertLatencyResearch<storage_type> research(num_keys, key_length);
+        hash_table immediate(RehashPolicy::kImmediate);
+        hash_table incremental(RehashPolicy::kIncremental);
+        flat_hash_table fht;
+
+        PrintInsertLatencyResearch_("HashTable (immediate rehash)", research.Run(immediate));
+        PrintInsertLatencyResearch_("HashTable (incremental rehash)", research.Run(incremental));
+        PrintInsertLatencyResearch_("FlatHashTable", research.Run(fht));
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::RehashResearch_()
+{
+    std::size_t num_keys;
+    std::size_t key_length;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the key length." << std::endl;
+    std::cin >> key_length;
+
+    if (!std::cin.fail())
+    {
+        RehashResearch<storage_type> research(num_keys, key_length);
+        hash_table ht;
+        flat_hash_table fht;
+
+        PrintRehashResearch_("HashTable", research.Run(ht));
+        PrintRehashResearch_("FlatHashTable", research.Run(fht));
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::ConcurrencyResearch_()
+{
+    std::size_t num_keys;
+    std::size_t ops_per_thread;
+    std::size_t read_percent;
+    std::size_t max_threads;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the number of operations per thread." << std::endl;
+    std::cin >> ops_per_thread;
+    std::cout << "Enter the percentage of reads." << std::endl;
+    std::cin >> read_percent;
+    std::cout << "Enter the maximum number of threads." << std::endl;
+    std::cin >> max_threads;
+
+    if (!std::cin.fail())
+    {
+        ConcurrencyResearch<storage_type> research(num_keys, 16, ops_per_thread, read_percent);
+
+        for (std::size_t num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+        {
+            concurrent_hash_table cht;
+            lock_free_read_hash_table lfht;
+            std::cout << "ConcurrentHashTable, " << num_threads << " threads: "
+                      << research.Run(cht, num_threads) << " ops/ms" << std::endl;
+            std::cout << "LockFreeReadHashTable, " << num_threads << " threads: "
+                      << research.Run(lfht, num_threads) << " ops/ms" << std::endl;
+        }
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::ReadWriteMixResearch_()
+{
+    std::size_t num_keys;
+    std::size_t ops_per_thread;
+    std::size_t num_threads;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the number of operations per thread." << std::endl;
+    std::cin >> ops_per_thread;
+    std::cout << "Enter the number of threads." << std::endl;
+    std::cin >> num_threads;
+
+    if (!std::cin.fail())
+    {
+        for (std::size_t read_percent : { 50, 90, 95, 99, 100 })
+        {
+            ConcurrencyResearch<storage_type> research(num_keys, 16, ops_per_thread, read_percent);
+            concurrent_hash_table cht;
+            lock_free_read_hash_table lfht;
+
+            std::cout << read_percent << "% reads:" << std::endl;
+            std::cout << "\tConcurrentHashTable: " << research.Run(cht, num_threads) << " ops/ms" << std::endl;
+            std::cout << "\tLockFreeReadHashTable: " << research.Run(lfht, num_threads) << " ops/ms" << std::endl;
+        }
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::HashQualityResearch_()
+{
+    std::size_t num_keys;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+
+    if (!std::cin.fail())
+    {
+        HashQualityResearch research(num_keys);
+
+        for (const auto& shape : research.Shapes())
+        {
+            std::cout << "Keys: " << shape.name << std::endl;
+            PrintHashQualityResearch_("std::hash", research.Run<std::hash<std::string>>(shape));
+            PrintHashQualityResearch_("wyhash", research.Run<WyHash>(shape));
+            PrintHashQualityResearch_("xxh3-style", research.Run<Xxh3Hash>(shape));
+        }
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::UploadResearch_()
+{
+    std::size_t num_lines;
+    std::size_t key_length;
+
+    std::cout << "Enter the number of lines." << std::endl;
+    std::cin >> num_lines;
+    std::cout << "Enter the key length." << std::endl;
+    std::cin >> key_length;
+
+    if (!std::cin.fail())
+    {
+        for (bool sorted : { false, true })
+        {
+            UploadResearch<wrapper_type> research(num_lines, key_length, sorted);
+            wrapper_type ht(new hash_table);
+            wrapper_type sbt(new rb_tree);
+            wrapper_type bpt(new b_plus_tree);
+            std::string order = sorted ? ", sorted file" : ", shuffled file";
+
+            PrintUploadResearch_("HashTable" + order, research.Run(ht));
+            PrintUploadResearch_("SelfBalancingBinarySearchTree" + order, research.Run(sbt));
+            PrintUploadResearch_("BPlusTree" + order, research.Run(bpt));
+        }
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::PointLookupResearch_()
+{
+    std::size_t num_keys;
+    std::size_t num_lookups;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the number of lookups." << std::endl;
+    std::cin >> num_lookups;
+
+    if (!std::cin.fail())
+    {
+        PointLookupResearch<storage_type> research(num_keys, 16, num_lookups);
+
+        for (std::size_t order : { 3, 8, 16, 32, 64, 128 })
+        {
+            b_plus_tree bpt(order);
+            PrintPointLookupResearch_("BPlusTree, order " + std::to_string(order), research.Run(bpt));
+        }
+
+        b_plus_tree bpt;
+        PrintPointLookupResearch_("BPlusTree, default order", research.Run(bpt));
+        rb_tree sbt;
+        PrintPointLookupResearch_("RBTree", research.Run(sbt));
+        pool_rb_tree pool_sbt;
+        PrintPointLookupResearch_("RBTree, pool allocator", research.Run(pool_sbt));
+        hash_table ht;
+        PrintPointLookupResearch_("HashTable", research.Run(ht));
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::NodeSearchResearch_()
+{
+    using int_storage_type = KeyValueStorageInterface<std::int64_t, Value>;
+
+    std::size_t num_keys;
+    std::size_t num_lookups;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the number of lookups." << std::endl;
+    std::cin >> num_lookups;
+
+    if (!std::cin.fail())
+    {
+        PointLookupResearch<storage_type> string_research(num_keys, 16, num_lookups);
+        PointLookupResearch<int_storage_type> int_research(num_keys, 0, num_lookups);
+
+        for (std::size_t order : { 8, 16, 32, 64, 128 })
+        {
+            std::cout << "Order " << order << ":" << std::endl;
+            {
+                BPlusTree<std::string, Value, LowerBoundSearch<std::string>> bpt(order);
+                PrintPointLookupResearch_("\tstring, lower_bound", string_research.Run(bpt));
+            }
+            {
+                BPlusTree<std::string, Value, BranchlessSearch<std::string>> bpt(order);
+                PrintPointLookupResearch_("\tstring, branchless", string_research.Run(bpt));
+            }
+            {
+                BPlusTree<std::string, Value, PrefixSearch> bpt(order);
+                PrintPointLookupResearch_("\tstring, prefix", string_research.Run(bpt));
+            }
+            {
+                BPlusTree<std::int64_t, Value, LowerBoundSearch<std::int64_t>> bpt(order);
+                PrintPointLookupResearch_("\tint64, lower_bound", int_research.Run(bpt));
+            }
+            {
+                BPlusTree<std::int64_t, Value, BranchlessSearch<std::int64_t>> bpt(order);
+                PrintPointLookupResearch_("\tint64, branchless", int_research.Run(bpt));
+            }
+            {
+                BPlusTree<std::int64_t, Value, SimdSearch<std::int64_t>> bpt(order);
+                PrintPointLookupResearch_("\tint64, simd", int_research.Run(bpt));
+            }
+        }
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::KeyCompressionResearch_()
+{
+    using plain_b_plus_tree = BPlusTree<std::string, Value, DefaultNodeSearch<std::string>, false>;
+
+    std::size_t num_keys;
+    std::size_t num_lookups;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the number of lookups." << std::endl;
+    std::cin >> num_lookups;
+
+    if (!std::cin.fail())
+    {
+        for (bool shared_prefixes : { true, false })
+        {
+            auto research = shared_prefixes
+                ? PointLookupResearch<storage_type>(num_keys, num_lookups, SharedPrefixKeys(num_keys))
+                : PointLookupResearch<storage_type>(num_keys, SharedPrefixKeys::kKeyLength, num_lookups);
+
+            std::cout << (shared_prefixes ? "Shared prefixes:" : "Random keys:") << std::endl;
+            for (std::size_t order : { b_plus_tree::kDefaultOrder, std::size_t{ 64 } })
+            {
+                {
+                    b_plus_tree bpt(order);
+                    PrintPointLookupResearch_("\tcompressed, order " + std::to_string(order), research.Run(bpt));
+                }
+                {
+                    plain_b_plus_tree bpt(order);
+                    PrintPointLookupResearch_("\tplain, order " + std::to_string(order), research.Run(bpt));
+                }
+            }
+        }
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::ConcurrentBPlusTreeResearch_()
+{
+    std::size_t num_keys;
+    std::size_t ops_per_thread;
+    std::size_t max_threads;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the number of operations per thread." << std::endl;
+    std::cin >> ops_per_thread;
+    std::cout << "Enter the maximum number of threads." << std::endl;
+    std::cin >> max_threads;
+
+    if (!std::cin.fail())
+    {
+        for (std::size_t read_percent : { 50, 90, 100 })
+        {
+            ConcurrencyResearch<storage_type> research(num_keys, 16, ops_per_thread, read_percent);
+
+            std::cout << read_percent << "% reads:" << std::endl;
+            for (std::size_t num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+            {
+                concurrent_b_plus_tree cbpt;
+                concurrent_hash_table cht;
+                std::cout << "\tConcurrentBPlusTree, " << num_threads << " threads: "
+                          << research.Run(cbpt, num_threads) << " ops/ms" << std::endl;
+                std::cout << "\tConcurrentHashTable, " << num_threads << " threads: "
+                          << research.Run(cht, num_threads) << " ops/ms" << std::endl;
+            }
+        }
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::PagedBPlusTreeResearch_()
+{
+    std::size_t num_keys;
+    std::size_t num_lookups;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the number of lookups." << std::endl;
+    std::cin >> num_lookups;
+
+    if (!std::cin.fail())
+    {
+        PagedStorageResearch<storage_type> research(num_keys, num_lookups);
+        auto path = std::filesystem::temp_directory_path() / "transactions_research.pages";
+
+        {
+            b_plus_tree bpt;
+            PrintPagedStorageResearch_("BPlusTree", research.Run(bpt));
+        }
+        for (std::size_t pool_pages : { std::size_t{ 64 }, std::size_t{ 1024 }, std::size_t{ 16384 } })
+        {
+            std::filesystem::remove(path);
+            paged_b_plus_tree pbpt(path, pool_pages);
+            PrintPagedStorageResearch_("PagedBPlusTree, " + std::to_string(pool_pages) + " pages", research.Run(pbpt));
+            std::cout << "\tpage reads " << pbpt.NumPageReads() << ", page writes " << pbpt.NumPageWrites() << std::endl;
+        }
+        std::filesystem::remove(path);
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::ChurnResearch_()
+{
+    std::size_t num_keys;
+    std::size_t num_ops;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the number of operations." << std::endl;
+    std::cin >> num_ops;
+
+    if (!std::cin.fail())
+    {
+        ChurnResearch<storage_type> research(num_keys, num_ops);
+
+        for (std::size_t order : { b_plus_tree::kDefaultOrder, std::size_t{ 8 } })
+        {
+            PrintChurnResearch_("BPlusTree, order " + std::to_string(order), research.RunAndDestroy(std::make_unique<b_plus_tree>(order)));
+        }
+        PrintChurnResearch_("RBTree", research.RunAndDestroy(std::make_unique<rb_tree>()));
+        PrintChurnResearch_("RBTree, pool allocator", research.RunAndDestroy(std::make_unique<pool_rb_tree>()));
+        PrintChurnResearch_("HashTable", research.RunAndDestroy(std::make_unique<hash_table>()));
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::EraseCycleResearch_()
+{
+    std::size_t num_keys;
+    std::size_t num_cycles;
+    double erase_fraction;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the number of cycles." << std::endl;
+    std::cin >> num_cycles;
+    std::cout << "Enter the part of the keys erased in a cycle (0..1)." << std::endl;
+    std::cin >> erase_fraction;
+
+    if (!std::cin.fail() && erase_fraction >= 0 && erase_fraction <= 1)
+    {
+        EraseCycleResearch<storage_type> research(num_keys, num_cycles, erase_fraction);
+
+        for (std::size_t order : { b_plus_tree::kDefaultOrder, std::size_t{ 8 } })
+        {
+            {
+                b_plus_tree bpt(order, ErasePolicy::kEager);
+                PrintEraseCycleResearch_("BPlusTree, order " + std::to_string(order) + ", eager", research.Run(bpt));
+            }
+            {
+                b_plus_tree bpt(order, ErasePolicy::kLazy);
+                PrintEraseCycleResearch_("BPlusTree, order " + std::to_string(order) + ", lazy", research.Run(bpt));
+            }
+            {
+                b_plus_tree bpt(order, ErasePolicy::kLazy);
+                PrintEraseCycleResearch_("BPlusTree, order " + std::to_string(order) + ", lazy + Compact",
+                                         research.Run(bpt, [&bpt](){ bpt.Compact(); }));
+            }
+        }
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::BatchUpdateResearch_()
+{
+    std::size_t num_keys;
+    std::size_t batch_size;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+    std::cout << "Enter the batch size." << std::endl;
+    std::cin >> batch_size;
+
+    if (!std::cin.fail())
+    {
+        BatchUpdateResearch<rb_tree> research(num_keys, batch_size);
+
+        PrintBatchUpdateResearch_("RBTree, one by one", research.RunOneByOne());
+        for (unsigned num_threads : { 1u, 2u, 4u, 8u })
+        {
+            PrintBatchUpdateResearch_("RBTree, batch, " + std::to_string(num_threads) + " threads", research.RunBatch(num_threads));
+        }
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::SortedBuildResearch_()
+{
+    std::size_t num_keys;
+
+    std::cout << "Enter the number of keys." << std::endl;
+    std::cin >> num_keys;
+
+    if (!std::cin.fail())
+    {
+        SortedBuildResearch<rb_tree> research(num_keys);
+        SortedBuildResearch<pool_rb_tree> pool_research(num_keys);
+
+        PrintSortedBuildResearch_("RBTree", research.Run());
+        PrintSortedBuildResearch_("RBTree, pool allocator", pool_research.Run());
+    }
+    else
+    {
+        std::cout << "\tTry again...\n";
+    }
+}
+
+void CLI::PrintStorageResearch_(const std::string& name, const StorageResearch<storage_type>::Result& result)
+{
+    std::cout << name << ": "
+              << "insert " << result.insert_ms << "ms, "
+              << "hit " << result.hit_ms << "ms, "
+              << "miss " << result.miss_ms << "ms, "
+              << "erase " << result.erase_ms << "ms" << std::endl;
+}
+
+void CLI::PrintInsertLatencyResearch_(const std::string& name, const InsertLatencyResearch<storage_type>::Result& result)
+{
+    std::cout << name << ": "
+              << "p50 " << result.p50_us << "us, "
+              << "p99 " << result.p99_us << "us, "
+              << "p99.9 " << result.p999_us << "us, "
+              << "max " << result.max_us << "us, "
+              << "total " << result.total_ms << "ms" << std::endl;
+}
+
+void CLI::PrintRehashResearch_(const std::string& name, const RehashResearch<storage_type>::Result& result)
+{
+    std::cout << name << ": "
+              << "fill " << result.fill_ms << "ms, "
+              << "rehash " << result.rehash_ms << "ms, "
+              << "miss " << result.miss_ms << "ms" << std::endl;
+}
+
+void CLI::PrintHashQualityResearch_(const std::string& name, const HashQualityResearch::Result& result)
+{
+    std::cout << "\t" << name << ": "
+              << "hash " << result.hash_ns << "ns/key, "
+              << "insert " << result.insert_ms << "ms, "
+              << "lookup " << result.lookup_ms << "ms, "
+              << "mean probe " << result.mean_probe_length << ", "
+              << "max chain " << result.max_chain_length << std::endl;
+    std::cout << "\t\tchains:";
+    for (std::size_t i = 0; i < result.chain_lengths.size(); ++i)
+    {
+        std::cout << " " << i << (i + 1 == result.chain_lengths.size() ? "+" : "") << "=" << result.chain_lengths[i] << "%";
+    }
+    std::cout << std::endl;
+}
+
+void CLI::PrintUploadResearch_(const std::string& name, const UploadResearch<wrapper_type>::Result& result)
+{
+    std::cout << name << ": "
+              << "upload " << result.upload_ms << "ms, "
+              << result.allocations_per_line << " allocations/line, "
+              << result.bytes_per_line << " bytes/line" << std::endl;
+}
+
+void CLI::PrintPointLookupResearch_(const std::string& name, const PointLookupResult& result)
+{
+    std::cout << name << ": "
+              << "fill " << result.fill_ms << "ms, "
+              << "hit " << result.hit_ns << "ns, "
+              << "miss " << result.miss_ns << "ns, "
+              << result.bytes_per_entry << " B/entry, "
+              << result.allocations_per_entry << " allocations/entry, "
+              << result.allocations_per_hit << " allocations/hit, "
+              << result.allocations_per_miss << " allocations/miss" << std::endl;
+}
+
+void CLI::PrintPagedStorageResearch_(const std::string& name, const PagedStorageResult& result)
+{
+    std::cout << name << ": "
+              << "fill " << result.fill_ms << "ms, "
+              << "heap " << result.heap_mb << "MB, "
+              << "hit " << result.hit_us << "us" << std::endl;
+}
+
+void CLI::PrintChurnResearch_(const std::string& name, const ChurnResult& result)
+{
+    std::cout << name << ": "
+              << "fill " << result.fill_ms << "ms, "
+              << "churn " << result.churn_ops_per_ms << " ops/ms, "
+              << "heap " << result.heap_mb << "MB, "
+              << "rss +" << result.rss_mb << "MB, "
+              << "teardown " << result.teardown_ms << "ms" << std::endl;
+}
+
+void CLI::PrintEraseCycleResearch_(const std::string& name, const EraseCycleResult& result)
+{
+    std::cout << name << ": "
+              << "erase " << result.erase_ms << "ms, "
+              << "reinsert " << result.reinsert_ms << "ms, "
+              << "hit " << result.hit_ms << "ms, "
+              << "heap " << result.heap_mb << "MB" << std::endl;
+}
+
+void CLI::PrintBatchUpdateResearch_(const std::string& name, const BatchUpdateResult& result)
+{
+    std::cout << name << ": "
+              << "insert " << result.insert_ms << "ms, "
+              << "erase " << result.erase_ms << "ms" << std::endl;
+}
+
+void CLI::PrintSortedBuildResearch_(const std::string& name, const SortedBuildResult& result)
+{
+    std::cout << name << ": "
+              << "insert one by one " << result.insert_ms << "ms, "
+              << "bulk load " << result.bulk_load_ms << "ms, "
+              << "copy " << result.copy_ms << "ms" << std::endl;
+}
+
 } // namespace s21
@@ -0,0 +1,124 @@
+#include "common/epoch_manager.h"
+
+#include <thread>
+#include <algorithm>
+
+namespace s21
+{
+
+EpochManager::Guard::Guard(EpochManager* manager, size_type slot) noexcept
+    : manager_(manager)
+    , slot_(slot)
+{}
+
+EpochManager::Guard::~Guard()
+{
+    manager_->Exit_(slot_);
+}
+
+EpochManager::EpochManager()
+    : slots_(std::make_unique<Slot[]>(kNumSlots))
+{}
+
+EpochManager::~EpochManager()
+{
+    for (const auto& retired : retired_)
+    {
+        retired.deleter(retired.pointer);
+    }
+}
+
+EpochManager::Guard EpochManager::Pin()
+{
+    return Guard(this, Enter_());
+}
+
+void EpochManager::Retire(void* pointer, deleter_type deleter)
+{
+    std::lock_guard lock(retired_mutex_);
+
+    retired_.push_back({ pointer, deleter, epoch_.load() });
+    if (++num_retired_since_reclaim_ >= kReclaimPeriod)
+    {
+        TryAdvance_();
+        FreeExpired_();
+    }
+}
+
+void EpochManager::Reclaim()
+{
+    // Two advances are needed before the most recently retired objects can go.
+    TryAdvance_();
+    TryAdvance_();
+
+    std::lock_guard lock(retired_mutex_);
+    FreeExpired_();
+}
+
+EpochManager::size_type EpochManager::Enter_()
+{
+    auto start = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+    for (;;)
+    {
+        for (size_type i = 0; i < kNumSlots; ++i)
+        {
+            auto& slot = slots_[(start + i) % kNumSlots];
+            auto epoch = epoch_.load();
+            auto expected = kInactive;
+
+            if (slot.epoch.load(std::memory_order_relaxed) != kInactive
+                || !slot.epoch.compare_exchange_strong(expected, epoch))
+            {
+                continue;
+            }
+
+            // The epoch may have moved between the load and the announcement, so
+            // keep announcing until the slot matches the global value.
+            for (auto current = epoch_.load(); current != epoch; current = epoch_.load())
+            {
+                epoch = current;
+                slot.epoch.store(epoch);
+            }
+
+            return (start + i) % kNumSlots;
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+void EpochManager::Exit_(size_type slot) noexcept
+{
+    slots_[slot].epoch.store(kInactive, std::memory_order_release);
+}
+
+bool EpochManager::TryAdvance_()
+{
+    auto epoch = epoch_.load();
+
+    for (size_type i = 0; i < kNumSlots; ++i)
+    {
+        if (auto slot_epoch = slots_[i].epoch.load(); slot_epoch != kInactive && slot_epoch != epoch)
+        {
+            return false;
+        }
+    }
+
+    return epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+void EpochManager::FreeExpired_()
+{
+    auto epoch = epoch_.load();
+    auto it = std::partition(retired_.begin(), retired_.end(), [epoch](const auto& x)
+    {
+        return x.epoch + 2 > epoch;
+    });
+
+    std::for_each(it, retired_.end(), [](const auto& x) { x.deleter(x.pointer); });
+    retired_.erase(it, retired_.end());
+    num_retired_since_reclaim_ = 0;
+}
+
+} // namespace s21
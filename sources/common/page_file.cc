@@ -0,0 +1,167 @@
+#include "common/page_file.h"
+
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace s21
+{
+
+PageFile::PageFile(const std::filesystem::path& path, size_type page_size)
+{
+    if (page_size < std::max(kMinPageSize, sizeof(Header)))
+    {
+        throw std::invalid_argument("The page size is too small.");
+    }
+
+    if (!std::filesystem::exists(path))
+    {
+        std::ofstream create(path, std::ios::binary);
+    }
+    file_.open(path, std::ios::in | std::ios::out | std::ios::binary);
+    if (!file_.is_open())
+    {
+        throw std::runtime_error("Could not open the page file.");
+    }
+
+    if (std::filesystem::file_size(path) == 0)
+    {
+        header_.magic = kMagic;
+        header_.page_size = page_size;
+        header_.num_pages = 1;
+        Sync();
+        return;
+    }
+
+    file_.read(reinterpret_cast<char*>(&header_), sizeof(Header));
+    if (!file_ || header_.magic != kMagic || header_.page_size != page_size)
+    {
+        throw std::runtime_error("The file is not a page file with this page size.");
+    }
+}
+
+PageFile::~PageFile()
+{
+    try
+    {
+        Sync();
+    }
+    catch (const std::exception&)
+    {
+    }
+}
+
+// A page that was allocated but never written reads as zeros.
+void PageFile::Read(page_id_type id, char* data)
+{
+    if (id == kNoPage || id >= header_.num_pages)
+    {
+        throw std::invalid_argument("There is no page with this id.");
+    }
+
+    Seek_(id);
+    file_.read(data, static_cast<std::streamsize>(header_.page_size));
+    if (file_.bad())
+    {
+        throw std::runtime_error("Could not read a page of the file.");
+    }
+
+    auto num_read = static_cast<size_type>(file_.gcount());
+    std::memset(data + num_read, 0, header_.page_size - num_read);
+    file_.clear();
+    ++num_reads_;
+}
+
+void PageFile::Write(page_id_type id, const char* data)
+{
+    if (id == kNoPage || id >= header_.num_pages)
+    {
+        throw std::invalid_argument("There is no page with this id.");
+    }
+
+    Seek_(id);
+    if (!file_.write(data, static_cast<std::streamsize>(header_.page_size)))
+    {
+        throw std::runtime_error("Could not write a page of the file.");
+    }
+    ++num_writes_;
+}
+
+PageFile::page_id_type PageFile::Allocate()
+{
+    if (header_.free_list == kNoPage)
+    {
+        return header_.num_pages++;
+    }
+
+    // A freed page starts with the id of the next freed page.
+    std::vector<char> page(header_.page_size);
+    auto id = header_.free_list;
+
+    Read(id, page.data());
+    std::memcpy(&header_.free_list, page.data(), sizeof(page_id_type));
+
+    return id;
+}
+
+void PageFile::Free(page_id_type id)
+{
+    std::vector<char> page(header_.page_size);
+
+    std::memcpy(page.data(), &header_.free_list, sizeof(page_id_type));
+    Write(id, page.data());
+    header_.free_list = id;
+}
+
+void PageFile::Sync()
+{
+    std::vector<char> page(header_.page_size);
+
+    std::memcpy(page.data(), &header_, sizeof(Header));
+    Seek_(kNoPage);
+    if (!file_.write(page.data(), static_cast<std::streamsize>(page.size())) || !file_.flush())
+    {
+        throw std::runtime_error("Could not write the header of the page file.");
+    }
+}
+
+PageFile::size_type PageFile::PageSize() const noexcept
+{
+    return header_.page_size;
+}
+
+PageFile::size_type PageFile::NumPages() const noexcept
+{
+    return header_.num_pages;
+}
+
+PageFile::size_type PageFile::NumReads() const noexcept
+{
+    return num_reads_;
+}
+
+PageFile::size_type PageFile::NumWrites() const noexcept
+{
+    return num_writes_;
+}
+
+std::uint64_t PageFile::UserValue(size_type index) const
+{
+    return header_.user_values.at(index);
+}
+
+void PageFile::SetUserValue(size_type index, std::uint64_t value)
+{
+    header_.user_values.at(index) = value;
+}
+
+void PageFile::Seek_(page_id_type id)
+{
+    auto offset = static_cast<std::streamoff>(id * header_.page_size);
+
+    file_.seekg(offset);
+    file_.seekp(offset);
+}
+
+} // namespace s21
@@ -0,0 +1,90 @@
+#include "common/slab_arena.h"
+
+#include <new>
+#include <algorithm>
+#include <stdexcept>
+
+namespace s21
+{
+
+// Blocks are rounded up to the alignment, so that every block of a slab is aligned.
+SlabArena::SlabArena(size_type block_size, size_type alignment)
+    : alignment_(alignment)
+{
+    if (alignment_ == 0 || (alignment_ & (alignment_ - 1)) != 0)
+    {
+        throw std::invalid_argument("The alignment must be a power of two.");
+    }
+
+    block_size_ = (std::max(block_size, sizeof(FreeBlock)) + alignment_ - 1) / alignment_ * alignment_;
+}
+
+SlabArena::~SlabArena()
+{
+    Release();
+}
+
+void* SlabArena::Allocate()
+{
+    if (free_list_ != nullptr)
+    {
+        auto block = free_list_;
+        free_list_ = block->next;
+        return block;
+    }
+
+    if (unused_ == unused_end_)
+    {
+        AddSlab_();
+    }
+
+    auto block = unused_;
+    unused_ += block_size_;
+    return block;
+}
+
+void SlabArena::Deallocate(void* block) noexcept
+{
+    free_list_ = ::new (block) FreeBlock{ free_list_ };
+}
+
+void SlabArena::Release() noexcept
+{
+    for (auto slab : slabs_)
+    {
+        ::operator delete(slab, std::align_val_t{ alignment_ });
+    }
+
+    slabs_.clear();
+    blocks_per_slab_ = kMinBlocksPerSlab;
+    free_list_ = nullptr;
+    unused_ = nullptr;
+    unused_end_ = nullptr;
+}
+
+SlabArena::size_type SlabArena::BlockSize() const noexcept
+{
+    return block_size_;
+}
+
+SlabArena::size_type SlabArena::NumSlabs() const noexcept
+{
+    return slabs_.size();
+}
+
+void SlabArena::AddSlab_()
+{
+    auto slab_size = blocks_per_slab_ * block_size_;
+
+    slabs_.reserve(slabs_.size() + 1);
+    unused_ = static_cast<std::byte*>(::operator new(slab_size, std::align_val_t{ alignment_ }));
+    unused_end_ = unused_ + slab_size;
+    slabs_.push_back(unused_);
+
+    if (2 * slab_size <= kMaxSlabSize)
+    {
+        blocks_per_slab_ *= 2;
+    }
+}
+
+} // namespace s21
@@ -1,5 +1,8 @@
 #include "tests/test_b_plus_tree.h"
 
+#include <random>
+#include <set>
+
 namespace Test
 {
 
@@ -21,6 +24,53 @@ void EraseKeys(BPlusTree<Key>* bpt, const std::vector<std::pair<Key, Value>>& ke
     }
 }
 
+TEST(InlineArraySuite_NP, Insert_RangeRollsBackOnThrow)
+{
+    // Copying "throw" fails, moving does not.
+    struct Element
+    {
+        explicit Element(std::string text) : text(std::move(text)) {}
+        Element(const Element& other) : text(other.text)
+        {
+            if (text == "throw")
+            {
+                throw std::runtime_error("copy");
+            }
+        }
+        Element(Element&& other) noexcept = default;
+
+        std::string text;
+    };
+
+    alignas(Element) std::byte storage[6 * sizeof(Element)];
+    InlineArray<Element> array(reinterpret_cast<Element*>(storage), 6);
+    array.insert(array.end(), Element("a"));
+    array.insert(array.end(), Element("b"));
+    array.insert(array.end(), Element("c"));
+
+    std::vector<Element> range;
+    range.reserve(2);
+    range.emplace_back("x");
+    range.emplace_back("throw");
+    EXPECT_THROW(array.insert(array.begin() + 1, range.begin(), range.end()), std::runtime_error);
+    ASSERT_EQ(array.size(), 3);
+    EXPECT_EQ(array[0].text, "a");
+    EXPECT_EQ(array[1].text, "b");
+    EXPECT_EQ(array[2].text, "c");
+
+    range.back().text = "y";
+    array.insert(array.begin() + 1, range.begin(), range.end());
+    ASSERT_EQ(array.size(), 5);
+    EXPECT_EQ(array[1].text, "x");
+    EXPECT_EQ(array[2].text, "y");
+    EXPECT_EQ(array[3].text, "b");
+
+    EXPECT_THROW(array.insert(array.end(), range.begin(), range.end()), std::length_error);
+    array.insert(array.end(), Element("z"));
+    EXPECT_THROW(array.insert(array.end(), Element("w")), std::length_error);
+    EXPECT_EQ(array.size(), 6);
+}
+
 TEST(BPlusTreeSuite_NP, Constructor_OrderLargerThan2)
 {
     EXPECT_NO_THROW(BPlusTree<std::string> bpt{3});
@@ -34,6 +84,365 @@ TEST(BPlusTreeSuite_NP, Constructor_OrderLessThan3)
     EXPECT_ANY_THROW(BPlusTree<std::string> bpt{2});
 }
 
+TEST(BPlusTreeSuite_NP, Scan_AfterErase)
+{
+    BPlusTree<std::string> bpt{3};
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_TRUE(bpt.Insert("key" + std::to_string(100 + i), value1));
+    }
+
+    std::vector<std::string> keys;
+    BPlusTree<std::string>::ScanCursor cursor;
+
+    do
+    {
+        auto batch = bpt.Scan(cursor, 7);
+        EXPECT_LE(batch.entries.size(), 7);
+        for (const auto& [key, value] : batch.entries)
+        {
+            keys.push_back(key);
+        }
+        cursor = batch.cursor;
+
+        // Erasing the last key returned must not break the cursor.
+        if (cursor.last_key)
+        {
+            EXPECT_TRUE(bpt.Erase(*cursor.last_key));
+        }
+    } while (!cursor.finished);
+
+    ASSERT_EQ(keys.size(), 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(keys[i], "key" + std::to_string(100 + i));
+    }
+}
+
+TEST(BPlusTreeSuite_NP, Erase_ShuffledKeys_SeveralOrders)
+{
+    for (std::size_t order : { 3, 4, 5, 8, 25, 64 })
+    {
+        BPlusTree<std::string> bpt{ order };
+        std::vector<std::string> keys;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            keys.push_back("key" + std::to_string(1000 + i));
+            EXPECT_TRUE(bpt.Insert(keys.back(), value1));
+        }
+
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(order));
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            EXPECT_TRUE(bpt.Erase(keys[i]));
+            EXPECT_FALSE(bpt.Exists(keys[i]));
+            if (i + 1 < keys.size())
+            {
+                EXPECT_TRUE(bpt.Exists(keys[i + 1]));
+            }
+        }
+
+        EXPECT_EQ(bpt.Size(), 0);
+        EXPECT_TRUE(bpt.ShowAll().empty());
+    }
+}
+
+template<class Key, class Search, class MakeKey>
+void CheckSearchPolicy(MakeKey make_key)
+{
+    for (std::size_t order : { 3, 8, 64 })
+    {
+        BPlusTree<Key, Value, Search> bpt{ order };
+
+        for (int i = 0; i < 500; i += 2)
+        {
+            EXPECT_TRUE(bpt.Insert(make_key(i), value1));
+        }
+        for (int i = 0; i < 500; ++i)
+        {
+            EXPECT_EQ(bpt.Exists(make_key(i)), i % 2 == 0);
+        }
+    }
+}
+
+TEST(BPlusTreeSuite_NP, SearchPolicies)
+{
+    // Keys longer than the 8 byte prefix that differ only after it, and keys shorter than it.
+    auto make_string = [](int i) { return (i % 3 ? "shared_prefix_" : "") + std::to_string(i); };
+    auto make_integer = [](int i) { return static_cast<std::int64_t>(i - 250) * 1000003; };
+
+    CheckSearchPolicy<std::string, LowerBoundSearch<std::string>>(make_string);
+    CheckSearchPolicy<std::string, BranchlessSearch<std::string>>(make_string);
+    CheckSearchPolicy<std::string, PrefixSearch>(make_string);
+    CheckSearchPolicy<std::int64_t, BranchlessSearch<std::int64_t>>(make_integer);
+    CheckSearchPolicy<std::int64_t, SimdSearch<std::int64_t>>(make_integer);
+    CheckSearchPolicy<std::int32_t, SimdSearch<std::int32_t>>(make_integer);
+}
+
+TEST(BPlusTreeSuite_NP, BulkLoad_SortedEntries)
+{
+    for (std::size_t order : { 3, 4, 5, 25, 64 })
+    {
+        for (double fill_factor : { 0.1, 0.75, 1.0 })
+        {
+            for (int num_keys : { 0, 1, 2, 7, 1000 })
+            {
+                BPlusTree<std::string> bpt{ order };
+                std::vector<std::pair<std::string, Value>> entries;
+
+                for (int i = 0; i < num_keys; ++i)
+                {
+                    entries.emplace_back("key" + std::to_string(10000 + 2 * i), value1);
+                }
+
+                auto expected_entries = entries;
+                EXPECT_EQ(bpt.BulkLoad(std::move(entries), fill_factor), num_keys);
+                EXPECT_EQ(bpt.Size(), num_keys);
+                EXPECT_EQ(bpt.ShowAll().size(), num_keys);
+
+                // The tree must stay valid for later inserts and erases.
+                for (int i = 0; i < num_keys; ++i)
+                {
+                    EXPECT_TRUE(bpt.Insert("key" + std::to_string(10001 + 2 * i), value2));
+                }
+                for (const auto& [key, value] : expected_entries)
+                {
+                    EXPECT_TRUE(bpt.Erase(key));
+                }
+                EXPECT_EQ(bpt.Size(), num_keys);
+                for (int i = 0; i < num_keys; ++i)
+                {
+                    EXPECT_EQ(bpt.GetValue("key" + std::to_string(10001 + 2 * i)), value2);
+                }
+            }
+        }
+    }
+}
+
+TEST(BPlusTreeSuite_NP, BulkLoad_FillFactorSetsLeafFill)
+{
+    constexpr int kNumKeys = 10000;
+
+    for (std::size_t order : { 5, 25, 64 })
+    {
+        for (double fill_factor : { 0.5, 0.75 })
+        {
+            BPlusTree<std::string> bpt{ order };
+            std::vector<std::pair<std::string, Value>> entries;
+
+            for (int i = 0; i < kNumKeys; ++i)
+            {
+                entries.emplace_back("key" + std::to_string(100000 + i), value1);
+            }
+            bpt.BulkLoad(std::move(entries), fill_factor);
+
+            auto average_fill = static_cast<double>(bpt.Size()) / static_cast<double>(bpt.NumLeaves());
+            EXPECT_NEAR(average_fill, std::round((order - 1) * fill_factor), 0.5) << "order " << order << ", fill factor " << fill_factor;
+        }
+    }
+}
+
+TEST(BPlusTreeSuite_NP, LazyErase_EraseAndReinsert)
+{
+    for (std::size_t order : { 3, 4, 5, 8, 25, 64 })
+    {
+        BPlusTree<std::string> bpt{ order, ErasePolicy::kLazy };
+        std::vector<std::string> keys;
+        std::mt19937 generator(order);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            keys.push_back("key" + std::to_string(1000 + i));
+            EXPECT_TRUE(bpt.Insert(keys.back(), i % 2 ? value1 : value2));
+        }
+
+        for (int cycle = 0; cycle < 3; ++cycle)
+        {
+            std::shuffle(keys.begin(), keys.end(), generator);
+            for (std::size_t i = 0; i < keys.size() * 9 / 10; ++i)
+            {
+                EXPECT_TRUE(bpt.Erase(keys[i]));
+                EXPECT_FALSE(bpt.Exists(keys[i]));
+            }
+            EXPECT_EQ(bpt.Size(), keys.size() - keys.size() * 9 / 10);
+            EXPECT_EQ(bpt.ShowAll().size(), bpt.Size());
+
+            for (std::size_t i = 0; i < keys.size() * 9 / 10; ++i)
+            {
+                EXPECT_TRUE(bpt.Insert(keys[i], value1));
+            }
+            EXPECT_EQ(bpt.Size(), keys.size());
+        }
+
+        std::shuffle(keys.begin(), keys.end(), generator);
+        for (const auto& key : keys)
+        {
+            EXPECT_TRUE(bpt.Erase(key));
+        }
+        EXPECT_EQ(bpt.Size(), 0);
+        EXPECT_TRUE(bpt.ShowAll().empty());
+    }
+}
+
+TEST(BPlusTreeSuite_NP, Compact_KeepsEntries)
+{
+    for (std::size_t order : { 3, 8, 25 })
+    {
+        for (auto policy : { ErasePolicy::kEager, ErasePolicy::kLazy })
+        {
+            BPlusTree<std::string> bpt{ order, policy };
+
+            bpt.Compact();
+            EXPECT_EQ(bpt.Size(), 0);
+
+            for (int i = 0; i < 1000; ++i)
+            {
+                EXPECT_TRUE(bpt.Insert("key" + std::to_string(1000 + i), i % 2 ? value1 : value2));
+            }
+            for (int i = 0; i < 1000; i += 3)
+            {
+                EXPECT_TRUE(bpt.Erase("key" + std::to_string(1000 + i)));
+            }
+
+            auto expected_entries = bpt.ShowAll();
+            bpt.Compact();
+            EXPECT_EQ(bpt.Size(), expected_entries.size());
+            EXPECT_EQ(bpt.ShowAll(), expected_entries);
+
+            // The rebuilt tree must stay valid for later inserts and erases.
+            for (int i = 0; i < 1000; ++i)
+            {
+                EXPECT_EQ(bpt.Insert("key" + std::to_string(1000 + i), value1), i % 3 == 0);
+            }
+            for (int i = 0; i < 1000; ++i)
+            {
+                EXPECT_TRUE(bpt.Erase("key" + std::to_string(1000 + i)));
+            }
+            EXPECT_EQ(bpt.Size(), 0);
+        }
+    }
+}
+
+TEST(BPlusTreeSuite_NP, OrderStatistics_SeveralOrders)
+{
+    for (std::size_t order : { 3, 4, 5, 8, 25 })
+    {
+        for (auto policy : { ErasePolicy::kEager, ErasePolicy::kLazy })
+        {
+            BPlusTree<std::string> bpt{ order, policy };
+            std::set<std::string> keys;
+            std::mt19937 generator(order);
+
+            CheckOrderStatistics(bpt, keys);
+            for (int i = 0; i < 600; ++i)
+            {
+                auto key = "key" + std::to_string(generator() % 400);
+                if (generator() % 3 == 0)
+                {
+                    EXPECT_EQ(bpt.Erase(key), keys.erase(key) == 1);
+                }
+                else
+                {
+                    EXPECT_EQ(bpt.Insert(key, value1), keys.insert(key).second);
+                }
+                if (i % 50 == 0)
+                {
+                    CheckOrderStatistics(bpt, keys);
+                }
+            }
+            CheckOrderStatistics(bpt, keys);
+
+            bpt.Compact();
+            CheckOrderStatistics(bpt, keys);
+        }
+    }
+}
+
+TEST(BPlusTreeSuite_NP, BulkLoad_FallsBackToInsert)
+{
+    BPlusTree<std::string> bpt{ 3 };
+
+    EXPECT_EQ(bpt.BulkLoad({ { "key2", value1 }, { "key1", value1 }, { "key2", value2 } }), 2);
+    EXPECT_EQ(bpt.BulkLoad({ { "key0", value1 }, { "key3", value1 } }), 2);
+    EXPECT_EQ(bpt.Size(), 4);
+    EXPECT_EQ(bpt.GetValue("key2"), value1);
+    EXPECT_ANY_THROW(bpt.BulkLoad({}, 0));
+    EXPECT_ANY_THROW(bpt.BulkLoad({}, 1.5));
+}
+
+TEST(BPlusTreeSuite_NP, RangeScan_PrefixScan)
+{
+    BPlusTree<std::string> bpt{ 4 };
+
+    for (int i = 100; i < 300; ++i)
+    {
+        EXPECT_TRUE(bpt.Insert("key" + std::to_string(i), value1));
+    }
+
+    auto range = bpt.RangeScan("key150", "key159", 0);
+    ASSERT_EQ(range.size(), 10);
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(range[i].first, "key" + std::to_string(150 + i));
+    }
+
+    EXPECT_EQ(bpt.RangeScan("key1500", "key1599", 0).size(), 9);
+    EXPECT_EQ(bpt.RangeScan("a", "z", 25).size(), 25);
+    EXPECT_EQ(bpt.RangeScan("a", "z", 0).size(), 200);
+    EXPECT_TRUE(bpt.RangeScan("key2", "key1", 0).empty());
+    EXPECT_TRUE(bpt.RangeScan("z", "zz", 0).empty());
+
+    auto prefix = bpt.PrefixScan("key29", 0);
+    ASSERT_EQ(prefix.size(), 10);
+    EXPECT_EQ(prefix.front().first, "key290");
+    EXPECT_EQ(prefix.back().first, "key299");
+    EXPECT_EQ(bpt.PrefixScan("key2", 3).size(), 3);
+    EXPECT_EQ(bpt.PrefixScan("", 0).size(), 200);
+    EXPECT_TRUE(bpt.PrefixScan("key3", 0).empty());
+}
+
+TEST(BPlusTreeSuite_NP, CompressedKeys_MatchPlainKeys)
+{
+    // Long shared prefixes, keys that are prefixes of others and keys outside the shared prefix.
+    std::vector<std::string> keys;
+    for (int i = 0; i < 600; ++i)
+    {
+        keys.push_back("tenant-" + std::to_string(i % 3) + "/customer-" + std::to_string(i % 20) + "/order-" + std::to_string(i));
+        keys.push_back("tenant-" + std::to_string(i % 3) + "/customer-" + std::to_string(i % 20));
+        keys.push_back(std::to_string(i));
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+    for (std::size_t order : { 3, 4, 8, 25 })
+    {
+        BPlusTree<std::string, Value, PrefixSearch, true> compressed{ order };
+        BPlusTree<std::string, Value, PrefixSearch, false> plain{ order };
+
+        for (const auto& key : keys)
+        {
+            EXPECT_EQ(compressed.Insert(key, value1), plain.Insert(key, value1));
+        }
+        for (std::size_t i = 0; i < keys.size(); i += 2)
+        {
+            EXPECT_EQ(compressed.Erase(keys[i]), plain.Erase(keys[i]));
+        }
+
+        EXPECT_EQ(compressed.Size(), plain.Size());
+        EXPECT_EQ(compressed.ShowAll(), plain.ShowAll());
+        EXPECT_EQ(compressed.RangeScan("tenant-1/customer-1", "tenant-1/customer-2", 0),
+                  plain.RangeScan("tenant-1/customer-1", "tenant-1/customer-2", 0));
+        EXPECT_EQ(compressed.PrefixScan("tenant-2/customer-1", 0), plain.PrefixScan("tenant-2/customer-1", 0));
+        for (const auto& key : keys)
+        {
+            EXPECT_EQ(compressed.Exists(key), plain.Exists(key));
+            EXPECT_EQ(compressed.Exists(key + "/"), plain.Exists(key + "/"));
+            EXPECT_EQ(compressed.Exists(key.substr(0, key.size() / 2)), plain.Exists(key.substr(0, key.size() / 2)));
+        }
+    }
+}
+
 TEST_P(BPlusTreeSuite, Erase_LeafNode_LargerThanMinSize)
 {
     InsertKeys(bpt, GetParam().std_dataset_identical_values, true);
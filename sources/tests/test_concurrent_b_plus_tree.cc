@@ -0,0 +1,174 @@
+#include "tests/test_concurrent_b_plus_tree.h"
+
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+namespace Test
+{
+
+TEST(ConcurrentBPlusTreeSuite_NP, Constructor_OrderLessThan3)
+{
+    EXPECT_ANY_THROW(ConcurrentBPlusTree<std::string> tree{ 2 });
+    EXPECT_NO_THROW(ConcurrentBPlusTree<std::string> tree{ 3 });
+}
+
+TEST_P(ConcurrentBPlusTreeSuite, Insert_Erase)
+{
+    auto num_keys = GetParam().num_keys;
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_TRUE(tree->Insert("key" + std::to_string(i), value1));
+        EXPECT_FALSE(tree->Insert("key" + std::to_string(i), value2));
+    }
+    EXPECT_EQ(tree->Size(), num_keys);
+
+    auto entries = tree->ShowAll();
+    ASSERT_EQ(entries.size(), num_keys);
+    EXPECT_TRUE(std::is_sorted(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs)
+    {
+        return lhs.first < rhs.first;
+    }));
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_EQ(tree->GetValue("key" + std::to_string(i)), value1);
+        EXPECT_TRUE(tree->Erase("key" + std::to_string(i)));
+        EXPECT_FALSE(tree->Exists("key" + std::to_string(i)));
+    }
+    EXPECT_EQ(tree->Size(), 0);
+    EXPECT_TRUE(tree->ShowAll().empty());
+    EXPECT_ANY_THROW(tree->GetValue("key0"));
+    EXPECT_FALSE(tree->Erase("key0"));
+}
+
+TEST_P(ConcurrentBPlusTreeSuite, Scan_RangeScan_PrefixScan)
+{
+    for (int i = 100; i < 300; ++i)
+    {
+        tree->Insert("key" + std::to_string(i), value1);
+    }
+
+    std::vector<std::string> keys;
+    ConcurrentBPlusTree<std::string>::ScanCursor cursor;
+    while (!cursor.finished)
+    {
+        auto result = tree->Scan(cursor, 7);
+        EXPECT_LE(result.entries.size(), 7);
+        for (const auto& [key, value] : result.entries)
+        {
+            keys.push_back(key);
+        }
+        cursor = result.cursor;
+    }
+    ASSERT_EQ(keys.size(), 200);
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+    auto range = tree->RangeScan("key150", "key159", 0);
+    ASSERT_EQ(range.size(), 10);
+    EXPECT_EQ(range.front().first, "key150");
+    EXPECT_EQ(range.back().first, "key159");
+    EXPECT_EQ(tree->RangeScan("a", "z", 25).size(), 25);
+    EXPECT_TRUE(tree->RangeScan("key2", "key1", 0).empty());
+
+    auto prefix = tree->PrefixScan("key29", 0);
+    ASSERT_EQ(prefix.size(), 10);
+    EXPECT_EQ(prefix.front().first, "key290");
+    EXPECT_EQ(prefix.back().first, "key299");
+    EXPECT_TRUE(tree->PrefixScan("key3", 0).empty());
+}
+
+TEST_P(ConcurrentBPlusTreeSuite, Read_WhileWriting)
+{
+    auto [order, num_keys, num_threads] = GetParam();
+    std::atomic<bool> done{ false };
+    std::vector<std::thread> readers;
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        tree->Insert("key" + std::to_string(i), value1);
+    }
+    auto num_prefixed = tree->PrefixScan("key1", 0).size();
+
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+        readers.emplace_back([&]()
+        {
+            // Keys that are never erased must stay visible through every split and merge.
+            while (!done)
+            {
+                for (std::size_t i = 0; i < num_keys; i += 97)
+                {
+                    EXPECT_TRUE(tree->Exists("key" + std::to_string(i)));
+                    EXPECT_EQ(tree->GetValue("key" + std::to_string(i)), value1);
+                }
+                EXPECT_EQ(tree->PrefixScan("key1", 0).size(), num_prefixed);
+            }
+        });
+    }
+
+    for (std::size_t i = 0; i < num_keys * 4; ++i)
+    {
+        EXPECT_TRUE(tree->Insert("new_key" + std::to_string(i), value2));
+        if (i % 2)
+        {
+            EXPECT_TRUE(tree->Erase("new_key" + std::to_string(i)));
+        }
+    }
+
+    done = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(tree->Size(), num_keys * 3);
+}
+
+TEST_P(ConcurrentBPlusTreeSuite, Write_FromManyThreads)
+{
+    auto [order, num_keys, num_threads] = GetParam();
+    std::vector<std::thread> writers;
+
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+        writers.emplace_back([&, t]()
+        {
+            // Keys of all threads are interleaved, so the threads split and merge the same leaves.
+            for (auto i = t; i < num_keys; i += num_threads)
+            {
+                EXPECT_TRUE(tree->Insert("key" + std::to_string(i), value1));
+            }
+            for (auto i = t; i < num_keys; i += num_threads)
+            {
+                if (i % 3)
+                {
+                    EXPECT_TRUE(tree->Erase("key" + std::to_string(i)));
+                }
+            }
+        });
+    }
+
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+
+    std::vector<std::string> expected_keys;
+    for (std::size_t i = 0; i < num_keys; i += 3)
+    {
+        expected_keys.push_back("key" + std::to_string(i));
+    }
+    std::sort(expected_keys.begin(), expected_keys.end());
+
+    auto entries = tree->ShowAll();
+    ASSERT_EQ(entries.size(), expected_keys.size());
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        EXPECT_EQ(entries[i].first, expected_keys[i]);
+    }
+    EXPECT_EQ(tree->Size(), expected_keys.size());
+}
+
+} // namespace Test
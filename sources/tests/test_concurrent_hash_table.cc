@@ -0,0 +1,106 @@
+#include "tests/test_concurrent_hash_table.h"
+
+#include <thread>
+#include <atomic>
+
+namespace Test
+{
+
+template<class Func>
+void RunThreads(std::size_t num_threads, Func func)
+{
+    std::vector<std::thread> threads;
+
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back(func, t);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+TEST_P(ConcurrentHashTableSuite, Insert_DisjointKeys)
+{
+    auto [num_keys, num_threads] = GetParam();
+
+    RunThreads(num_threads, [&](std::size_t t)
+    {
+        for (auto i = t; i < num_keys; i += num_threads)
+        {
+            EXPECT_TRUE(hash_table->Insert("key" + std::to_string(i), value1));
+        }
+    });
+
+    EXPECT_EQ(hash_table->Size(), num_keys);
+    EXPECT_EQ(hash_table->ShowAll().size(), num_keys);
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_EQ(hash_table->GetValue("key" + std::to_string(i)), value1);
+    }
+}
+
+TEST_P(ConcurrentHashTableSuite, Insert_IdenticalKeys)
+{
+    auto [num_keys, num_threads] = GetParam();
+    std::atomic<std::size_t> num_inserted{ 0 };
+
+    RunThreads(num_threads, [&](std::size_t)
+    {
+        for (std::size_t i = 0; i < num_keys; ++i)
+        {
+            num_inserted += hash_table->Insert("key" + std::to_string(i), value1);
+        }
+    });
+
+    EXPECT_EQ(num_inserted, num_keys);
+    EXPECT_EQ(hash_table->Size(), num_keys);
+}
+
+TEST_P(ConcurrentHashTableSuite, Erase_WhileReading)
+{
+    auto [num_keys, num_threads] = GetParam();
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        hash_table->Insert("key" + std::to_string(i), value1);
+    }
+    hash_table->Insert("stable_key", value2);
+
+    RunThreads(num_threads, [&](std::size_t t)
+    {
+        for (std::size_t i = 0; i < num_keys; ++i)
+        {
+            if (i % num_threads == t)
+            {
+                EXPECT_TRUE(hash_table->Erase("key" + std::to_string(i)));
+                EXPECT_TRUE(hash_table->Insert("new_key" + std::to_string(i), value2));
+            }
+            else
+            {
+                EXPECT_EQ(hash_table->GetValue("stable_key"), value2);
+            }
+        }
+    });
+
+    EXPECT_EQ(hash_table->Size(), num_keys + 1);
+    EXPECT_ANY_THROW(hash_table->GetValue("key0"));
+    EXPECT_EQ(hash_table->GetValue("new_key0"), value2);
+}
+
+TEST_P(ConcurrentHashTableSuite, Reserve)
+{
+    hash_table->Reserve(GetParam().num_keys);
+    EXPECT_EQ(hash_table->Size(), 0);
+    EXPECT_TRUE(hash_table->Insert("key", value1));
+    EXPECT_EQ(hash_table->GetValue("key"), value1);
+}
+
+TEST(ConcurrentHashTable, ZeroStripes)
+{
+    EXPECT_THROW(ConcurrentHashTable<std::string>(0), std::invalid_argument);
+}
+
+} // namespace Test
@@ -200,6 +200,35 @@ TYPED_TEST(ContainerWrapperSuite, Exists_Timestamp)
     EXPECT_FALSE(this->container_wrapper->Exists("any_key"));
 }
 
+TYPED_TEST(ContainerWrapperSuite, Lookup_StringView)
+{
+    InsertKeys(this->container_wrapper, this->params_.std_dataset_identical_values, true);
+    EXPECT_TRUE(this->container_wrapper->Insert("timed_key", value2, 100));
+
+    std::string buffer;
+    for (const auto& kv : this->params_.std_dataset_identical_values)
+    {
+        buffer += kv.first + " ";
+    }
+    buffer += "timed_key";
+
+    // Keys are looked up straight from the buffer, the way a command parser would.
+    std::string_view input(buffer);
+    for (std::size_t i = 0; i < this->params_.std_dataset_identical_values.size(); ++i)
+    {
+        auto key = input.substr(0, input.find(' '));
+        input.remove_prefix(key.size() + 1);
+
+        EXPECT_TRUE(this->container_wrapper->Exists(key));
+        EXPECT_EQ(this->container_wrapper->GetValue(key), value1);
+        EXPECT_TRUE(this->container_wrapper->Erase(key));
+        EXPECT_FALSE(this->container_wrapper->Exists(key));
+    }
+    EXPECT_GT(this->container_wrapper->TTL(input), 0);
+    EXPECT_TRUE(this->container_wrapper->Erase(input));
+    EXPECT_TRUE(this->container_wrapper->Keys().empty());
+}
+
 TYPED_TEST(ContainerWrapperSuite, Erase_KeyExists)
 {
     InsertKeys(this->container_wrapper, this->params_.std_dataset_identical_values, true);
@@ -303,6 +332,25 @@ TYPED_TEST(ContainerWrapperSuite, Keys)
     EXPECT_EQ(result, expected_result);
 }
 
+TYPED_TEST(ContainerWrapperSuite, Keys_SeveralScanBatches)
+{
+    static constexpr std::size_t num_keys = 5000;
+    std::vector<std::string> expected_result;
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        expected_result.push_back("key" + std::to_string(i));
+        EXPECT_TRUE(this->container_wrapper->Insert(expected_result.back(), i % 2 ? value1 : value2, 0));
+    }
+
+    auto result = this->container_wrapper->Keys();
+    std::sort(result.begin(), result.end());
+    std::sort(expected_result.begin(), expected_result.end());
+    EXPECT_EQ(result, expected_result);
+    EXPECT_EQ(this->container_wrapper->Find(value1).size(), num_keys / 2);
+    EXPECT_EQ(this->container_wrapper->ShowAll().size(), num_keys);
+}
+
 TYPED_TEST(ContainerWrapperSuite, Keys_ContainerEmpty)
 {
     std::vector<std::string> result{};
@@ -508,6 +556,62 @@ TYPED_TEST(ContainerWrapperSuite, ContainerWrapperSuite)
     CheckUpload(this->container_wrapper, path, 7);
 }
 
+TYPED_TEST(ContainerWrapperSuite, Upload_ExportedFile)
+{
+    static constexpr std::size_t num_keys = 3000;
+    auto path = std::filesystem::temp_directory_path() / ("upload_exported_" + this->GetTypeName() + ".txt");
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_TRUE(this->container_wrapper->Insert("key" + std::to_string(i), value1, i % 10 == 0 ? 100 : 0));
+    }
+    EXPECT_EQ(this->container_wrapper->Export(path), num_keys);
+
+    ContainerWrapper<TypeParam> uploaded;
+    EXPECT_EQ(uploaded.Upload(path), num_keys);
+    std::filesystem::remove(path);
+
+    auto keys = uploaded.Keys();
+    auto expected_keys = this->container_wrapper->Keys();
+    std::sort(keys.begin(), keys.end());
+    std::sort(expected_keys.begin(), expected_keys.end());
+    EXPECT_EQ(keys, expected_keys);
+    EXPECT_GT(uploaded.TTL("key0"), 0);
+    EXPECT_EXCEPTION(uploaded.TTL("key1"), std::runtime_error, "The key does not have a timestamp.");
+    EXPECT_TRUE(uploaded.Insert("key", value2, 0));
+    EXPECT_TRUE(uploaded.Erase("key10"));
+}
+
+TYPED_TEST(ContainerWrapperSuite, RangeScan_PrefixScan)
+{
+    InsertKeys(this->container_wrapper, this->params_.std_dataset_different_values, true);
+    EXPECT_TRUE(this->container_wrapper->Insert("table", value1, 1));
+    EXPECT_TRUE(this->container_wrapper->Insert("tender", value1, 0));
+
+    if constexpr (std::is_same_v<TypeParam, HashTable<std::string>>)
+    {
+        EXPECT_EXCEPTION(this->container_wrapper->RangeScan("a", "z"), std::runtime_error, "The storage does not keep its keys ordered.");
+        EXPECT_EXCEPTION(this->container_wrapper->PrefixScan("t"), std::runtime_error, "The storage does not keep its keys ordered.");
+    }
+    else
+    {
+        std::vector<std::pair<std::string, Value>> expected_range{
+                {"table",     value1},
+                {"tease",     value2},
+                {"tender",    value1},
+                {"tight",     value1},
+                {"tycoon",    value1},
+        };
+        EXPECT_EQ(this->container_wrapper->RangeScan("t", "tz"), expected_range);
+        EXPECT_EQ(this->container_wrapper->PrefixScan("t", 2).size(), 2);
+        EXPECT_EQ(this->container_wrapper->PrefixScan("te").size(), 2);
+
+        sleep(2);
+        expected_range.erase(expected_range.begin());
+        EXPECT_EQ(this->container_wrapper->PrefixScan("t"), expected_range);
+    }
+}
+
 TYPED_TEST(ContainerWrapperSuite, Upload_FileDoesNotExist)
 {
     EXPECT_EXCEPTION(this->container_wrapper->Upload("any_file"), std::runtime_error, "File 'any_file' not exists.");
@@ -0,0 +1,81 @@
+#include "tests/test_flat_hash_table.h"
+
+namespace Test
+{
+
+void InsertKeys(FlatHashTable<std::string>* hash_table, std::size_t num_keys, const bool expect)
+{
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_EQ(hash_table->Insert("key" + std::to_string(i), value1), expect);
+    }
+}
+
+void EraseKeys(FlatHashTable<std::string>* hash_table, std::size_t num_keys, const bool expect)
+{
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_EQ(hash_table->Erase("key" + std::to_string(i)), expect);
+    }
+}
+
+TEST_P(FlatHashTableSuite, Insert_DifferentKeys)
+{
+    InsertKeys(hash_table, GetParam().num_keys, true);
+    EXPECT_EQ(hash_table->Size(), GetParam().num_keys);
+    EXPECT_LE(hash_table->Size(), hash_table->Capacity());
+}
+
+TEST_P(FlatHashTableSuite, Insert_IdenticalKeys)
+{
+    InsertKeys(hash_table, GetParam().num_keys, true);
+    InsertKeys(hash_table, GetParam().num_keys, false);
+    EXPECT_EQ(hash_table->Size(), GetParam().num_keys);
+}
+
+TEST_P(FlatHashTableSuite, GetValue_KeyExists)
+{
+    InsertKeys(hash_table, GetParam().num_keys, true);
+    for (std::size_t i = 0; i < GetParam().num_keys; ++i)
+    {
+        EXPECT_EQ(hash_table->GetValue("key" + std::to_string(i)), value1);
+    }
+}
+
+TEST_P(FlatHashTableSuite, GetValue_KeyDoesNotExist)
+{
+    InsertKeys(hash_table, GetParam().num_keys, true);
+    EXPECT_ANY_THROW(hash_table->GetValue("any_key"));
+}
+
+TEST_P(FlatHashTableSuite, Erase_KeyExists)
+{
+    InsertKeys(hash_table, GetParam().num_keys, true);
+    EraseKeys(hash_table, GetParam().num_keys, true);
+    EraseKeys(hash_table, GetParam().num_keys, false);
+    EXPECT_EQ(hash_table->Size(), 0);
+    EXPECT_TRUE(hash_table->ShowAll().empty());
+}
+
+TEST_P(FlatHashTableSuite, Erase_Reinsert)
+{
+    for (auto i = 0; i < 10; ++i)
+    {
+        InsertKeys(hash_table, GetParam().num_keys, true);
+        EraseKeys(hash_table, GetParam().num_keys, true);
+    }
+    InsertKeys(hash_table, GetParam().num_keys, true);
+    EXPECT_EQ(hash_table->ShowAll().size(), GetParam().num_keys);
+}
+
+TEST_P(FlatHashTableSuite, Reserve)
+{
+    hash_table->Reserve(GetParam().num_keys);
+    auto capacity = hash_table->Capacity();
+    EXPECT_GE(capacity, GetParam().num_keys);
+
+    InsertKeys(hash_table, GetParam().num_keys, true);
+    EXPECT_EQ(hash_table->Capacity(), capacity);
+}
+
+} // namespace Test
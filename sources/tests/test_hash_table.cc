@@ -1,5 +1,7 @@
 #include "tests/test_hash_table.h"
 
+#include <unordered_set>
+
 namespace Test
 {
 
@@ -21,4 +23,294 @@ TEST_P(HashTableSuite, Rehash)
     }
 }
 
+TEST_P(HashTableSuite, Rehash_EraseAll)
+{
+    InsertKeys(hash_table, GetParam().std_dataset_identical_values, true);
+    for (const auto& kv : GetParam().std_dataset_identical_values)
+    {
+        EXPECT_TRUE(hash_table->Erase(kv.first));
+    }
+    EXPECT_TRUE(hash_table->ShowAll().empty());
+}
+
+TEST_P(HashTableSuite, Rehash_ManyKeys)
+{
+    static constexpr std::size_t num_keys = 10000;
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_TRUE(hash_table->Insert("key" + std::to_string(i), value1));
+    }
+    EXPECT_EQ(hash_table->ShowAll().size(), num_keys);
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_EQ(hash_table->GetValue("key" + std::to_string(i)), value1);
+        EXPECT_FALSE(hash_table->Insert("key" + std::to_string(i), value2));
+    }
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_TRUE(hash_table->Erase("key" + std::to_string(i)));
+    }
+    EXPECT_TRUE(hash_table->ShowAll().empty());
+}
+
+TEST_P(HashTableSuite, Reserve)
+{
+    hash_table->Reserve(1000);
+    auto bucket_count = hash_table->BucketCount();
+    EXPECT_GE(bucket_count, 1000);
+
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(hash_table->Insert("key" + std::to_string(i), value1));
+    }
+    EXPECT_EQ(hash_table->BucketCount(), bucket_count);
+    EXPECT_EQ(hash_table->Size(), 1000);
+}
+
+TEST_P(HashTableSuite, Reserve_EraseKeepsBuckets)
+{
+    hash_table->Reserve(1000);
+    auto bucket_count = hash_table->BucketCount();
+
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        EXPECT_TRUE(hash_table->Insert("key" + std::to_string(i), value1));
+    }
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        EXPECT_TRUE(hash_table->Erase("key" + std::to_string(i)));
+        EXPECT_EQ(hash_table->BucketCount(), bucket_count);
+    }
+}
+
+TEST_P(HashTableSuite, MaxLoadFactor)
+{
+    EXPECT_ANY_THROW(hash_table->SetMaxLoadFactor(0.0f));
+    EXPECT_ANY_THROW(hash_table->SetMaxLoadFactor(-1.0f));
+
+    hash_table->SetMaxLoadFactor(0.5f);
+    InsertKeys(hash_table, GetParam().std_dataset_identical_values, true);
+    EXPECT_LE(hash_table->Size(), hash_table->BucketCount() * hash_table->MaxLoadFactor());
+
+    hash_table->SetMaxLoadFactor(4.0f);
+    InsertKeys(hash_table, GetParam().std_dataset_different_values, false);
+    for (const auto& kv : GetParam().std_dataset_identical_values)
+    {
+        EXPECT_EQ(hash_table->GetValue(kv.first), value1);
+    }
+}
+
+TEST_P(HashTableSuite, Shrink)
+{
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        EXPECT_TRUE(hash_table->Insert("key" + std::to_string(i), value1));
+    }
+    auto peak_bucket_count = hash_table->BucketCount();
+
+    for (std::size_t i = 0; i < 9990; ++i)
+    {
+        EXPECT_TRUE(hash_table->Erase("key" + std::to_string(i)));
+    }
+    EXPECT_LT(hash_table->BucketCount(), peak_bucket_count / 100);
+    for (std::size_t i = 9990; i < 10000; ++i)
+    {
+        EXPECT_EQ(hash_table->GetValue("key" + std::to_string(i)), value1);
+    }
+}
+
+TEST_P(HashTableSuite, BucketCount_PowerOfTwo)
+{
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(hash_table->Insert("key" + std::to_string(i), value1));
+        EXPECT_EQ(hash_table->BucketCount() & (hash_table->BucketCount() - 1), 0);
+    }
+
+    hash_table->Reserve(3000);
+    EXPECT_EQ(hash_table->BucketCount() & (hash_table->BucketCount() - 1), 0);
+}
+
+template<class Hash>
+void CheckHasher()
+{
+    std::unordered_set<std::size_t> hashes;
+    std::string key;
+
+    // Every length class of the hashers, from empty keys to multi-block ones.
+    for (std::size_t i = 0; i <= 300; ++i)
+    {
+        EXPECT_EQ(Hash{}(key), Hash{}(std::string(key)));
+        hashes.insert(Hash{}(key));
+        key.push_back(static_cast<char>('a' + i % 26));
+    }
+    EXPECT_EQ(hashes.size(), 301);
+
+    HashTable<std::string, Value, Hash> hash_table;
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(hash_table.Insert("key" + std::to_string(i), value1));
+    }
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(hash_table.GetValue("key" + std::to_string(i)), value1);
+        EXPECT_TRUE(hash_table.Erase("key" + std::to_string(i)));
+    }
+    EXPECT_EQ(hash_table.Size(), 0);
+}
+
+TEST_P(HashTableSuite, Scan_WhileResizing)
+{
+    static constexpr std::size_t num_keys = 1000;
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_TRUE(hash_table->Insert("key" + std::to_string(i), value1));
+    }
+
+    std::unordered_set<std::string> keys;
+    HashTable<std::string>::ScanCursor cursor;
+    std::size_t num_extra_keys = 0;
+
+    // The table grows while the scan runs and shrinks again before it ends.
+    do
+    {
+        auto batch = hash_table->Scan(cursor, 10);
+        for (const auto& [key, value] : batch.entries)
+        {
+            keys.insert(key);
+        }
+        cursor = batch.cursor;
+
+        if (num_extra_keys < 3000)
+        {
+            for (std::size_t i = 0; i < 30; ++i, ++num_extra_keys)
+            {
+                hash_table->Insert("extra" + std::to_string(num_extra_keys), value2);
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < num_extra_keys; ++i)
+            {
+                hash_table->Erase("extra" + std::to_string(i));
+            }
+        }
+    } while (!cursor.finished);
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_TRUE(keys.count("key" + std::to_string(i)));
+    }
+}
+
+TEST_P(HashTableSuite, Scan_WhileShrinking)
+{
+    static constexpr std::size_t num_keys = 8000;
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_TRUE(hash_table->Insert("key" + std::to_string(i), value1));
+    }
+
+    // A full scan between erases, so some of them run in the middle of a shrink.
+    for (std::size_t i = 0; i < num_keys - 100; ++i)
+    {
+        EXPECT_TRUE(hash_table->Erase("key" + std::to_string(i)));
+        if (i % 97 != 0)
+        {
+            continue;
+        }
+
+        std::unordered_set<std::string> keys;
+        std::size_t num_entries = 0;
+        HashTable<std::string>::ScanCursor cursor;
+        do
+        {
+            auto batch = hash_table->Scan(cursor, 50);
+            for (const auto& [key, value] : batch.entries)
+            {
+                keys.insert(key);
+            }
+            num_entries += batch.entries.size();
+            cursor = batch.cursor;
+        } while (!cursor.finished);
+
+        EXPECT_EQ(num_entries, hash_table->Size());
+        EXPECT_EQ(keys.size(), hash_table->Size());
+    }
+}
+
+TEST_P(HashTableSuite, Scan_EraseBetweenCalls)
+{
+    static constexpr std::size_t num_keys = 8000;
+    static constexpr std::size_t shrink_size = 2048;
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_TRUE(hash_table->Insert("key" + std::to_string(i), value1));
+    }
+
+    // Every tenth key stays for the whole scan, the others are erased.
+    std::size_t next_erased = 0;
+    auto erase_next = [&]()
+    {
+        if (next_erased % 10 == 0)
+        {
+            ++next_erased;
+        }
+        EXPECT_TRUE(hash_table->Erase("key" + std::to_string(next_erased++)));
+    };
+    while (hash_table->Size() > shrink_size)
+    {
+        erase_next();
+    }
+
+    std::unordered_set<std::string> keys;
+    auto scan = [&](const HashTable<std::string>::ScanCursor& cursor)
+    {
+        auto batch = hash_table->Scan(cursor, 300);
+        for (const auto& [key, value] : batch.entries)
+        {
+            keys.insert(key);
+        }
+        return batch.cursor;
+    };
+
+    // The first erase after the first call shrinks the table. The others move the
+    // buckets of the old table, past the size of the new one, behind the cursor.
+    auto cursor = scan({});
+    for (std::size_t i = 0; i < 640; ++i)
+    {
+        erase_next();
+    }
+    while (!cursor.finished)
+    {
+        cursor = scan(cursor);
+    }
+
+    for (std::size_t i = 0; i < num_keys; i += 10)
+    {
+        EXPECT_TRUE(keys.count("key" + std::to_string(i))) << "key" << i;
+    }
+}
+
+TEST_P(HashTableSuite, Scan_Empty)
+{
+    auto batch = hash_table->Scan({}, 10);
+    EXPECT_TRUE(batch.entries.empty());
+    EXPECT_TRUE(batch.cursor.finished);
+}
+
+TEST(Hashers, WyHash)
+{
+    CheckHasher<WyHash>();
+}
+
+TEST(Hashers, Xxh3Hash)
+{
+    CheckHasher<Xxh3Hash>();
+}
+
 } // namespace Test
@@ -0,0 +1,91 @@
+#include "tests/test_lock_free_read_hash_table.h"
+
+#include <thread>
+#include <atomic>
+
+namespace Test
+{
+
+TEST_P(LockFreeReadHashTableSuite, Insert_Erase)
+{
+    auto num_keys = GetParam().num_keys;
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_TRUE(hash_table->Insert("key" + std::to_string(i), value1));
+        EXPECT_FALSE(hash_table->Insert("key" + std::to_string(i), value2));
+    }
+    EXPECT_EQ(hash_table->Size(), num_keys);
+    EXPECT_EQ(hash_table->ShowAll().size(), num_keys);
+    EXPECT_GE(hash_table->BucketCount(), num_keys);
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_EQ(hash_table->GetValue("key" + std::to_string(i)), value1);
+        EXPECT_TRUE(hash_table->Erase("key" + std::to_string(i)));
+        EXPECT_FALSE(hash_table->Exists("key" + std::to_string(i)));
+    }
+    EXPECT_EQ(hash_table->Size(), 0);
+    EXPECT_ANY_THROW(hash_table->GetValue("key0"));
+    EXPECT_FALSE(hash_table->Erase("key0"));
+}
+
+TEST_P(LockFreeReadHashTableSuite, Read_WhileWriting)
+{
+    auto [num_keys, num_threads] = GetParam();
+    std::atomic<bool> done{ false };
+    std::vector<std::thread> readers;
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        hash_table->Insert("key" + std::to_string(i), value1);
+    }
+
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+        readers.emplace_back([&]()
+        {
+            // Keys that are never erased must stay visible through every resize.
+            while (!done)
+            {
+                for (std::size_t i = 0; i < num_keys; i += 97)
+                {
+                    EXPECT_TRUE(hash_table->Exists("key" + std::to_string(i)));
+                    EXPECT_EQ(hash_table->GetValue("key" + std::to_string(i)), value1);
+                }
+            }
+        });
+    }
+
+    for (std::size_t i = 0; i < num_keys * 4; ++i)
+    {
+        EXPECT_TRUE(hash_table->Insert("new_key" + std::to_string(i), value2));
+        if (i % 2)
+        {
+            EXPECT_TRUE(hash_table->Erase("new_key" + std::to_string(i)));
+        }
+    }
+
+    done = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(hash_table->Size(), num_keys * 3);
+}
+
+TEST_P(LockFreeReadHashTableSuite, Reserve)
+{
+    hash_table->Reserve(GetParam().num_keys);
+    auto bucket_count = hash_table->BucketCount();
+    EXPECT_GT(bucket_count, GetParam().num_keys);
+
+    for (std::size_t i = 0; i < GetParam().num_keys; ++i)
+    {
+        hash_table->Insert("key" + std::to_string(i), value1);
+    }
+    EXPECT_EQ(hash_table->BucketCount(), bucket_count);
+}
+
+} // namespace Test
@@ -0,0 +1,202 @@
+#include "tests/test_paged_b_plus_tree.h"
+
+namespace Test
+{
+
+TEST(PagedBPlusTreeSuite_NP, Constructor_TooSmall)
+{
+    auto path = PagedBPlusTreeTestPath();
+
+    std::filesystem::remove(path);
+    EXPECT_THROW(PagedBPlusTree<std::string>(path, 7), std::invalid_argument);
+    EXPECT_THROW(PagedBPlusTree<std::string>(path, 8, 64), std::invalid_argument);
+    std::filesystem::remove(path);
+}
+
+TEST(PagedBPlusTreeSuite_NP, Constructor_OtherPageSize)
+{
+    auto path = PagedBPlusTreeTestPath();
+
+    std::filesystem::remove(path);
+    {
+        PagedBPlusTree<std::string> tree(path, 8, 512);
+        tree.Insert("key", value1);
+    }
+    EXPECT_THROW(PagedBPlusTree<std::string>(path, 8, 1024), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(PagedBPlusTreeSuite_NP, Reopen_CorruptPage)
+{
+    static constexpr std::size_t page_size = 512;
+    auto path = PagedBPlusTreeTestPath();
+
+    std::filesystem::remove(path);
+    {
+        PagedBPlusTree<std::string> tree(path, 8, page_size);
+        for (int i = 0; i < 100; ++i)
+        {
+            tree.Insert("key" + std::to_string(i), value1);
+        }
+    }
+
+    // The first key of every node claims to be longer than a page.
+    auto num_pages = std::filesystem::file_size(path) / page_size;
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        std::uint32_t length = 0xFFFFFF00;
+        for (std::size_t page = 1; page < num_pages; ++page)
+        {
+            file.seekp(static_cast<std::streamoff>(page * page_size + 1 + sizeof(std::uint32_t) + sizeof(PageFile::page_id_type)));
+            file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        }
+    }
+
+    EXPECT_THROW(
+    {
+        PagedBPlusTree<std::string> tree(path, 8, page_size);
+        tree.ShowAll();
+    }, std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST_P(PagedBPlusTreeSuite, Insert_Erase)
+{
+    auto num_keys = GetParam().num_keys;
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_TRUE(tree->Insert("key" + std::to_string(i), value1));
+        EXPECT_FALSE(tree->Insert("key" + std::to_string(i), value2));
+    }
+    EXPECT_EQ(tree->Size(), num_keys);
+
+    auto entries = tree->ShowAll();
+    ASSERT_EQ(entries.size(), num_keys);
+    EXPECT_TRUE(std::is_sorted(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs)
+    {
+        return lhs.first < rhs.first;
+    }));
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_EQ(tree->GetValue("key" + std::to_string(i)), value1);
+        EXPECT_TRUE(tree->Erase("key" + std::to_string(i)));
+        EXPECT_FALSE(tree->Exists("key" + std::to_string(i)));
+    }
+    EXPECT_EQ(tree->Size(), 0);
+    EXPECT_TRUE(tree->ShowAll().empty());
+    EXPECT_ANY_THROW(tree->GetValue("key0"));
+    EXPECT_FALSE(tree->Erase("key0"));
+}
+
+TEST_P(PagedBPlusTreeSuite, Insert_EntryTooLarge)
+{
+    Value value = value1;
+
+    value.city = std::string(GetParam().page_size / 4, 'a');
+    EXPECT_THROW(tree->Insert("key", value), std::invalid_argument);
+    EXPECT_THROW(tree->Insert(std::string(GetParam().page_size / 4, 'a'), value1), std::invalid_argument);
+    EXPECT_EQ(tree->Size(), 0);
+}
+
+TEST_P(PagedBPlusTreeSuite, GetValue_WriteThroughReference)
+{
+    auto num_keys = GetParam().num_keys;
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        tree->Insert("key" + std::to_string(i), value1);
+    }
+
+    // The changed pages are evicted by the lookups that follow.
+    for (std::size_t i = 0; i < num_keys; i += 2)
+    {
+        tree->GetValue("key" + std::to_string(i)).coins = static_cast<int>(i);
+    }
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        EXPECT_EQ(tree->GetValue("key" + std::to_string(i)).coins, i % 2 ? value1.coins : static_cast<int>(i));
+    }
+}
+
+TEST_P(PagedBPlusTreeSuite, Reopen_KeepsEntries)
+{
+    auto num_keys = GetParam().num_keys;
+
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+        tree->Insert("key" + std::to_string(i), i % 2 ? value1 : value2);
+    }
+    for (std::size_t i = 0; i < num_keys; i += 3)
+    {
+        tree->Erase("key" + std::to_string(i));
+    }
+    auto entries = tree->ShowAll();
+
+    delete tree;
+    tree = Open();
+
+    EXPECT_EQ(tree->Size(), entries.size());
+    auto reopened = tree->ShowAll();
+    ASSERT_EQ(reopened.size(), entries.size());
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        EXPECT_EQ(reopened[i].first, entries[i].first);
+        EXPECT_EQ(reopened[i].second, entries[i].second);
+    }
+    EXPECT_TRUE(tree->Insert("key0", value1));
+    EXPECT_FALSE(tree->Insert("key1", value1));
+}
+
+TEST_P(PagedBPlusTreeSuite, Scan_RangeScan_PrefixScan)
+{
+    for (int i = 100; i < 300; ++i)
+    {
+        tree->Insert("key" + std::to_string(i), value1);
+    }
+
+    std::vector<std::string> keys;
+    PagedBPlusTree<std::string>::ScanCursor cursor;
+    while (!cursor.finished)
+    {
+        auto result = tree->Scan(cursor, 7);
+        EXPECT_LE(result.entries.size(), 7);
+        for (const auto& [key, value] : result.entries)
+        {
+            keys.push_back(key);
+        }
+        cursor = result.cursor;
+    }
+    ASSERT_EQ(keys.size(), 200);
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+    auto range = tree->RangeScan("key150", "key159", 0);
+    ASSERT_EQ(range.size(), 10);
+    EXPECT_EQ(range.front().first, "key150");
+    EXPECT_EQ(range.back().first, "key159");
+    EXPECT_EQ(tree->RangeScan("a", "z", 25).size(), 25);
+    EXPECT_TRUE(tree->RangeScan("key2", "key1", 0).empty());
+
+    auto prefix = tree->PrefixScan("key29", 0);
+    ASSERT_EQ(prefix.size(), 10);
+    EXPECT_EQ(prefix.front().first, "key290");
+    EXPECT_EQ(prefix.back().first, "key299");
+    EXPECT_TRUE(tree->PrefixScan("key3", 0).empty());
+}
+
+// The paged tree keeps no counts, so this runs the Scan based defaults of the interface.
+TEST_P(PagedBPlusTreeSuite, OrderStatistics)
+{
+    std::set<std::string> keys;
+
+    CheckOrderStatistics(*tree, keys);
+    for (int i = 100; i < 700; i += 3)
+    {
+        keys.insert("key" + std::to_string(i));
+        tree->Insert("key" + std::to_string(i), value1);
+    }
+    CheckOrderStatistics(*tree, keys);
+}
+
+} // namespace Test
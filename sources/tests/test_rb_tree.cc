@@ -1,5 +1,8 @@
 #include "tests/test_rb_tree.h"
 
+#include <random>
+#include <algorithm>
+
 namespace Test
 {
 
@@ -110,4 +113,273 @@ TEST_F(TreeRemovingAdv, Remove_03)
     EXPECT_TRUE(tree.isEmpty());
 }
 
+TEST_F(TreeAdding, RemoveByIterator_ReturnsNext)
+{
+    for (int i = 0; i < 101; ++i)
+    {
+        tree.addNode(i * 37 % 101);
+    }
+
+    // Inner nodes with two children are removed too, and the returned iterator must still point into the tree.
+    int expected = 0;
+    for (auto it = tree.begin(); it != tree.end(); ++expected)
+    {
+        EXPECT_EQ(*it, expected);
+        if (expected % 2 == 0)
+        {
+            it = tree.removeNode(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    EXPECT_EQ(expected, 101);
+    EXPECT_EQ(tree.Size(), 50);
+    EXPECT_EQ(*tree.begin(), 1);
+}
+
+TEST(KVTreeSuite_NP, OrderStatistics)
+{
+    SelfBalancingBinarySearchTree<std::string> kvtree;
+    std::set<std::string> keys;
+    std::mt19937 generator(42);
+
+    CheckOrderStatistics(kvtree, keys);
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto key = "key" + std::to_string(generator() % 400);
+        if (generator() % 3 == 0)
+        {
+            EXPECT_EQ(kvtree.Erase(key), keys.erase(key) == 1);
+        }
+        else
+        {
+            EXPECT_EQ(kvtree.Insert(key, value1), keys.insert(key).second);
+        }
+        if (i % 50 == 0)
+        {
+            CheckOrderStatistics(kvtree, keys);
+        }
+    }
+    CheckOrderStatistics(kvtree, keys);
+}
+
+TEST(TreeSuite_NP, BuildFromSorted)
+{
+    for (int count = 0; count < 70; ++count)
+    {
+        std::vector<int> values(count);
+        for (int i = 0; i < count; ++i)
+        {
+            values[i] = 2 * i;
+        }
+
+        s21_utils::rbTree<int> tree;
+        tree.addNode(-1);
+        tree.buildFromSorted(values.begin(), values.end());
+        ASSERT_TRUE(Compare(tree, values));
+
+        // The built tree has to stay valid under further changes.
+        s21_utils::rbTree<int> copy = tree;
+        for (int i = 0; i < count; ++i)
+        {
+            copy.addNode(2 * i + 1);
+            EXPECT_TRUE(copy.FindKey(2 * i).second);
+        }
+        std::vector<int> left;
+        for (int i = 0; i < 2 * count; ++i)
+        {
+            if (i % 4 == 0)
+            {
+                EXPECT_EQ(copy.removeNode(i), 1);
+            }
+            else
+            {
+                left.push_back(i);
+            }
+        }
+        ASSERT_TRUE(Compare(copy, left));
+        ASSERT_TRUE(Compare(tree, values));
+    }
+}
+
+TEST(KVTreeSuite_NP, BulkLoad_SortedEntries)
+{
+    SelfBalancingBinarySearchTree<std::string> kvtree;
+    std::vector<std::pair<std::string, Value>> entries;
+    std::set<std::string> keys;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto key = "key" + std::to_string(1000 + i);
+        entries.emplace_back(key, i % 2 == 0 ? value1 : value2);
+        keys.insert(key);
+    }
+
+    EXPECT_EQ(kvtree.BulkLoad(entries), entries.size());
+    EXPECT_EQ(kvtree.GetValue("key1001"), value2);
+    CheckOrderStatistics(kvtree, keys);
+
+    EXPECT_TRUE(kvtree.Erase("key1500"));
+    keys.erase("key1500");
+    CheckOrderStatistics(kvtree, keys);
+}
+
+TEST(KVTreeSuite_NP, BulkLoad_FallsBackToInsert)
+{
+    SelfBalancingBinarySearchTree<std::string> kvtree;
+
+    EXPECT_EQ(kvtree.BulkLoad({ { "key2", value1 }, { "key1", value1 }, { "key2", value2 } }), 2);
+    EXPECT_EQ(kvtree.BulkLoad({ { "key0", value1 }, { "key3", value1 } }), 2);
+    EXPECT_EQ(kvtree.Size(), 4);
+    EXPECT_EQ(kvtree.GetValue("key2"), value1);
+}
+
+// Counts its constructions, and compares with plain ints so that it can be looked up by one.
+struct CountedInt
+{
+    CountedInt(int value, int* num_constructed)
+        : value(value)
+    {
+        ++*num_constructed;
+    }
+
+    int value;
+};
+
+bool operator<(const CountedInt& lhs, const CountedInt& rhs) { return lhs.value < rhs.value; }
+bool operator<(const CountedInt& lhs, int rhs) { return lhs.value < rhs; }
+bool operator<(int lhs, const CountedInt& rhs) { return lhs < rhs.value; }
+
+TEST(TreeSuite_NP, EmplaceNode_DuplicateNotConstructed)
+{
+    s21_utils::rbTree<CountedInt, std::less<>> tree;
+    int num_constructed = 0;
+
+    EXPECT_TRUE(tree.emplaceNode(2, &num_constructed).second);
+    EXPECT_TRUE(tree.emplaceNode(1, &num_constructed).second);
+    EXPECT_EQ(num_constructed, 2);
+
+    auto [it, ok] = tree.emplaceNode(2, &num_constructed);
+    EXPECT_FALSE(ok);
+    EXPECT_EQ(it->value, 2);
+    EXPECT_EQ(num_constructed, 2);
+    EXPECT_EQ(tree.Size(), 2);
+}
+
+TEST(TreeSuite_NP, UnionAndDifference)
+{
+    std::mt19937 generator(17);
+
+    for (unsigned num_threads : { 1u, 4u })
+    {
+        for (int size : { 0, 1, 100, 40000 })
+        {
+            std::set<int> own_values;
+            std::set<int> other_values;
+            s21_utils::rbTree<int> own;
+            s21_utils::rbTree<int> other;
+
+            for (int i = 0; i < size; ++i)
+            {
+                own_values.insert(static_cast<int>(generator() % (3 * size)));
+                other_values.insert(static_cast<int>(generator() % (3 * size)));
+            }
+            // Built from sorted values, as inserting them one by one checks the whole tree in debug builds.
+            own.buildFromSorted(own_values.begin(), own_values.end());
+            other.buildFromSorted(other_values.begin(), other_values.end());
+
+            std::vector<int> united;
+            std::set_union(own_values.begin(), own_values.end(), other_values.begin(), other_values.end(), std::back_inserter(united));
+            s21_utils::rbTree<int> copy = other;
+            EXPECT_EQ(own.unionWith(std::move(copy), num_threads), united.size() - own_values.size());
+            EXPECT_TRUE(copy.isEmpty());
+            ASSERT_TRUE(Compare(own, united));
+
+            std::vector<int> rest;
+            std::set_difference(united.begin(), united.end(), other_values.begin(), other_values.end(), std::back_inserter(rest));
+            EXPECT_EQ(own.differenceWith(std::move(other), num_threads), other_values.size());
+            EXPECT_TRUE(other.isEmpty());
+            ASSERT_TRUE(Compare(own, rest));
+
+            // Every second value that is left, after a key that is not there.
+            std::vector<int> erased{ -5 };
+            std::vector<int> kept;
+            for (std::size_t i = 0; i < rest.size(); ++i)
+            {
+                (i % 2 == 0 ? erased : kept).push_back(rest[i]);
+            }
+            EXPECT_EQ(own.eraseSorted(erased.begin(), erased.end(), num_threads), erased.size() - 1);
+            ASSERT_TRUE(Compare(own, kept));
+
+            // The result has to stay valid under further changes.
+            own.addNode(-1);
+            own.removeNode(-1);
+            ASSERT_TRUE(Compare(own, kept));
+        }
+    }
+}
+
+TEST(TreeSuite_NP, UnionWith_SharedArenaTakesNodes)
+{
+    using pool_tree = s21_utils::rbTree<std::string, std::less<std::string>, PoolAllocator<std::string>>;
+    pool_tree tree{ "a", "c" };
+    pool_tree batch(tree.get_allocator());
+    std::vector<std::string> values{ "b", "d" };
+
+    batch.buildFromSorted(values.begin(), values.end());
+    EXPECT_TRUE(batch.get_allocator() == tree.get_allocator());
+    const auto* node_value = &*batch.FindKey("b").first;
+    EXPECT_EQ(tree.unionWith(std::move(batch)), 2);
+    EXPECT_EQ(&*tree.FindKey("b").first, node_value);
+
+    // The emptied batch must not release the arena the tree still uses.
+    batch.clearTree();
+    EXPECT_GT(tree.get_allocator().Arena().NumSlabs(), 0);
+    tree.addNode("e");
+    EXPECT_EQ(std::vector<std::string>(tree.begin(), tree.end()), std::vector<std::string>({ "a", "b", "c", "d", "e" }));
+}
+
+// The batch of a pool allocated tree shares the arena of the tree, so it is merged without copying nodes.
+template<class Storage>
+void InsertAndEraseBatch(Storage& kvtree)
+{
+    std::set<std::string> keys;
+
+    EXPECT_TRUE(kvtree.Insert("key100", value2));
+    keys.insert("key100");
+
+    std::vector<std::pair<std::string, Value>> entries;
+    for (int i = 0; i < 500; ++i)
+    {
+        auto key = "key" + std::to_string(i * 7 % 300);
+        entries.emplace_back(key, value1);
+        keys.insert(key);
+    }
+
+    EXPECT_EQ(kvtree.InsertBatch(entries, 2), 299);
+    EXPECT_EQ(kvtree.GetValue("key100"), value2);
+    CheckOrderStatistics(kvtree, keys);
+
+    std::vector<std::string> erased{ "key5", "key10", "key5", "key1000" };
+    EXPECT_EQ(kvtree.EraseBatch(erased, 2), 2);
+    keys.erase("key5");
+    keys.erase("key10");
+    CheckOrderStatistics(kvtree, keys);
+}
+
+TEST(KVTreeSuite_NP, InsertAndEraseBatch)
+{
+    SelfBalancingBinarySearchTree<std::string> kvtree;
+    InsertAndEraseBatch(kvtree);
+}
+
+TEST(KVTreeSuite_NP, InsertAndEraseBatch_PoolAllocator)
+{
+    SelfBalancingBinarySearchTree<std::string, Value, PoolAllocator<std::pair<const std::string, Value>>> kvtree;
+    InsertAndEraseBatch(kvtree);
+}
+
 } // namespace Test
@@ -35,4 +35,35 @@ TEST_F(TreeBase, iter)
     EXPECT_TRUE(res == std::vector<int>({26, 25, 24, 8, 5, 3}));
 }
 
+TEST(TreeBaseSuite_NP, PoolAllocator)
+{
+    using pool_tree = s21_utils::rbTree<std::string, std::less<std::string>, PoolAllocator<std::string>>;
+    auto to_vector = [](const pool_tree& tree) { return std::vector<std::string>(tree.begin(), tree.end()); };
+
+    // Moving a pool tree gives the moved from tree a new arena, which may throw.
+    static_assert(std::is_nothrow_move_constructible_v<s21_utils::rbTree<std::string>>);
+    static_assert(!std::is_nothrow_move_constructible_v<pool_tree>);
+    static_assert(!std::is_constructible_v<PoolAllocator<std::string>, PoolAllocator<int>>);
+
+    pool_tree tree{"b", "c", "a"};
+    pool_tree copy = tree;
+    pool_tree moved = std::move(tree);
+
+    // Every tree owns its arena, so clearing one leaves the others intact.
+    copy.clearTree();
+    EXPECT_TRUE(copy.isEmpty());
+    EXPECT_EQ(to_vector(moved), std::vector<std::string>({"a", "b", "c"}));
+
+    tree.addNode("d");
+    copy.addNode("e");
+    moved.removeNode(moved.FindKey("b").first);
+    moved.addNode("f");
+    EXPECT_EQ(to_vector(tree), std::vector<std::string>({"d"}));
+    EXPECT_EQ(to_vector(copy), std::vector<std::string>({"e"}));
+    EXPECT_EQ(to_vector(moved), std::vector<std::string>({"a", "c", "f"}));
+
+    tree = std::move(moved);
+    EXPECT_EQ(to_vector(tree), std::vector<std::string>({"a", "c", "f"}));
+}
+
 } // namespace Test
@@ -0,0 +1,113 @@
+#include "tests/test_slab_arena.h"
+
+namespace Test
+{
+
+TEST(SlabArenaSuite_NP, Constructor_AlignmentNotPowerOfTwo)
+{
+    EXPECT_THROW(SlabArena(16, 0), std::invalid_argument);
+    EXPECT_THROW(SlabArena(16, 3), std::invalid_argument);
+    EXPECT_THROW(SlabArena(16, 24), std::invalid_argument);
+}
+
+TEST(SlabArenaSuite_NP, Allocate_BlocksAligned)
+{
+    for (std::size_t alignment : { 1, 8, 16, 64 })
+    {
+        SlabArena arena{ 20, alignment };
+
+        EXPECT_GE(arena.BlockSize(), 20);
+        EXPECT_EQ(arena.BlockSize() % alignment, 0);
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_TRUE(IsAligned(arena.Allocate(), alignment)) << "alignment " << alignment;
+        }
+    }
+}
+
+TEST(SlabArenaSuite_NP, Allocate_SmallBlockHoldsFreeListLink)
+{
+    SlabArena arena{ 1, 1 };
+    EXPECT_GE(arena.BlockSize(), sizeof(void*));
+}
+
+TEST(SlabArenaSuite_NP, Deallocate_BlocksReused)
+{
+    SlabArena arena{ 32, 8 };
+    std::vector<void*> blocks;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        blocks.push_back(arena.Allocate());
+    }
+    auto num_slabs = arena.NumSlabs();
+
+    // The last freed block comes back first.
+    arena.Deallocate(blocks[3]);
+    arena.Deallocate(blocks[7]);
+    EXPECT_EQ(arena.Allocate(), blocks[7]);
+    EXPECT_EQ(arena.Allocate(), blocks[3]);
+
+    for (auto block : blocks)
+    {
+        arena.Deallocate(block);
+    }
+    std::set<void*> reused;
+    for (std::size_t i = 0; i < blocks.size(); ++i)
+    {
+        reused.insert(arena.Allocate());
+    }
+    EXPECT_EQ(reused, std::set<void*>(blocks.begin(), blocks.end()));
+    EXPECT_EQ(arena.NumSlabs(), num_slabs);
+}
+
+TEST(SlabArenaSuite_NP, Allocate_SlabsGrowUpToMaxSize)
+{
+    constexpr std::size_t kBlockSize = 64;
+    SlabArena arena{ kBlockSize, 8 };
+    auto blocks_per_slab = SlabArena::kMinBlocksPerSlab;
+    std::size_t num_blocks = 0;
+
+    for (std::size_t num_slabs = 1; num_slabs <= 20; ++num_slabs)
+    {
+        // The next slab is only added once every block of the last one is handed out.
+        for (std::size_t i = 0; i < blocks_per_slab; ++i, ++num_blocks)
+        {
+            arena.Allocate();
+            EXPECT_EQ(arena.NumSlabs(), num_slabs);
+        }
+        if (2 * blocks_per_slab * kBlockSize <= SlabArena::kMaxSlabSize)
+        {
+            blocks_per_slab *= 2;
+        }
+    }
+
+    EXPECT_EQ(blocks_per_slab * kBlockSize, SlabArena::kMaxSlabSize);
+    arena.Allocate();
+    EXPECT_EQ(arena.NumSlabs(), 21);
+}
+
+TEST(SlabArenaSuite_NP, Release_GivesBackAllSlabs)
+{
+    SlabArena arena{ 48, 16 };
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        arena.Allocate();
+    }
+    EXPECT_GT(arena.NumSlabs(), 1);
+
+    arena.Release();
+    EXPECT_EQ(arena.NumSlabs(), 0);
+
+    // The arena starts over with a small slab and no free list.
+    for (std::size_t i = 0; i < SlabArena::kMinBlocksPerSlab; ++i)
+    {
+        EXPECT_TRUE(IsAligned(arena.Allocate(), 16));
+    }
+    EXPECT_EQ(arena.NumSlabs(), 1);
+    arena.Allocate();
+    EXPECT_EQ(arena.NumSlabs(), 2);
+}
+
+} // namespace Test